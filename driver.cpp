@@ -26,7 +26,23 @@ Just for an example on how to use the defined datatypes.
 */
 
 #include "intrin_generic.h"
+#include "intrin_stats.h"
+#include "intrin_sort.h"
+#include "intrin_scan.h"
+#include "intrin_complex.h"
+#include "intrin_random.h"
+#include "intrin_quant.h"
+#include "intrin_parse.h"
+#include "intrin_pipeline.h"
+#include "intrin_interp.h"
+#include "intrin_image.h"
+#include "intrin_tune.h"
+#include "intrin_codec.h"
+#include "intrin_knn.h"
+#include "intrin_ring.h"
+#include "intrin_resample.h"
 #include <iostream>
+#include <vector>
 using std::cout;
 int main() {
 
@@ -36,6 +52,125 @@ int main() {
     float_8_array_a32 result = vec_a * vec_b; // Type-matching multiplication operation: _mm256_mul_ps(vec_A, vec_B)
 
     std::cout << delim(result, ", "); // Printing the vector in one line
+    std::cout << "\n";
+
+    // Bulk statistics work on any buffer, or directly on the vector types
+    running_stats<float> stats;
+    stats.push(result.data, 8);
+    std::cout << "mean: " << stats.mean() << " variance: " << stats.variance()
+              << " argmax: " << argmax(result) << "\n";
+
+    // Sorting and top-k selection over buffers
+    float top[3];
+    simd_top_k(result.data, 8, 3, top);
+    std::cout << "top 3: " << top[0] << ", " << top[1] << ", " << top[2] << "\n";
+
+    // Filtering with a predicate and cumulative sums
+    float_8_array_a32 kept {};
+    const std::size_t kept_count = simd_copy_if(result.data, 8, kept.data, above(10000.0f));
+    simd_inclusive_scan(kept.data, kept.data, kept_count);
+    std::cout << "cumulative sum of " << kept_count << " samples above 10000: " << delim(kept, ", ") << "\n";
+
+    // Complex vectors: 8 complex floats per register, stored interleaved
+    const complex_float tone = complex_float::from_split(vec_a, vec_b);
+    const complex_float mixed = tone * tone.conj(); // |z|^2 + 0i in every element
+    std::cout << "power: " << delim(tone.norm(), ", ") << "\n";
+    std::cout << "mixed: " << delim(mixed, ", ") << "\n";
+
+    // Random numbers: 8 generator streams side by side, one register of output per call
+    xoshiro256ss_x8 rng(2026);
+    float_16_array_a32 noise {};
+    fill_normal(rng, noise.data, 16, 0.0f, 0.5f);
+    std::cout << "noise: " << delim(noise, ", ") << "\n";
+
+    // Quantized GEMM: 2 uint8 activation rows against 3 int8 weight rows, scaled back to float
+    const std::uint8_t activations[2 * 4] = {10, 20, 30, 40, 1, 2, 3, 4};
+    const std::int8_t weights[3 * 4] = {1, 0, 0, 0, -1, 1, -1, 1, 2, 2, 2, 2};
+    const float scales[3] = {0.5f, 0.5f, 0.25f};
+    std::int32_t accumulators[2 * 3];
+    float dequantized[2 * 3];
+    quantized_gemm(activations, weights, accumulators, 2, 3, 4);
+    requantize(accumulators, 2, 3, scales, nullptr, dequantized);
+    std::cout << "dequantized: ";
+    write_text(std::cout, dequantized, 6, " ");
+    std::cout << "\n";
+
+    // Parsing numeric text straight into a vector type
+    const char csv[] = "1.5, 2.5, 3.5, 4.5\n5.5, 6.5, 7.5, 8.5\n";
+    float_8_array_a32 parsed {};
+    const parse_result parse_info = parse_numbers(csv, sizeof(csv) - 1, parsed.data, 8);
+    std::cout << parse_info.rows << " rows parsed: " << delim(parsed, ", ") << "\n";
+
+    // Pipelines: scale, clamp and sum in a single pass over the buffer
+    float_8_array_a32 shaped {};
+    const auto shaping = pipeline<float>() | scale_by(0.001f) | clamp_to(0.0f, 100.0f) | reduce_sum();
+    const auto [shaped_sum] = shaping.run(result.data, shaped.data, 8);
+    std::cout << "shaped: " << delim(shaped, ", ") << " sum: " << shaped_sum << "\n";
+
+    // Calibration curves: a polynomial and a lookup table with linear interpolation
+    const float calibration[3] = {0.5f, 2.0f, 0.25f}; // 0.5 + 2x + 0.25x^2
+    float_8_array_a32 calibrated {};
+    evaluate_polynomial(parsed.data, calibrated.data, 8, calibration);
+    const float response[5] = {0.0f, 1.0f, 4.0f, 9.0f, 16.0f};
+    const lut_interpolator<float> curve(response, 5, 0.0f, 8.0f);
+    float_8_array_a32 corrected {};
+    curve.apply(parsed, corrected);
+    std::cout << "calibrated: " << delim(calibrated, ", ") << "\ncorrected: " << delim(corrected, ", ") << "\n";
+
+    // Planes: a 4 x 2 uint8 image blurred and shrunk to 2 x 1
+    const std::uint8_t pixels[8] = {0, 64, 128, 255, 255, 128, 64, 0};
+    std::uint8_t blurred[8] = {}, shrunk[2] = {};
+    const image_plane<const std::uint8_t> image {pixels, 4, 2, 4};
+    box_blur(image, image_plane<std::uint8_t> {blurred, 4, 2, 4}, 1);
+    resize_area(image, image_plane<std::uint8_t> {shrunk, 2, 1, 2});
+    std::cout << "blurred: ";
+    write_text(std::cout, blurred, 8, " ");
+    std::cout << "\nshrunk: ";
+    write_text(std::cout, shrunk, 2, " ");
+    std::cout << "\n";
+
+    // Tuning: cache sizes of this machine and the parameters the kernels use (autotune() measures them)
+    const cache_topology caches = detect_cache_topology();
+    std::cout << "L1d " << caches.l1d << " L2 " << caches.l2 << " L3 " << caches.l3 << ", tile bytes " << tuning().tile_bytes << "\n";
+
+    // Codecs: a slowly varying int16 stream as zigzag deltas packed into 3 bits each
+    const std::int16_t samples[8] = {100, 101, 103, 102, 102, 99, 98, 100};
+    std::uint16_t deltas[8] = {};
+    std::uint32_t packed[8] = {};
+    std::int16_t restored[8] = {};
+    delta_zigzag_encode(samples, 8, deltas, samples[0]);
+    const unsigned bits = max_bits(deltas, 8);
+    const std::size_t words = bit_pack(deltas, 8, bits, packed);
+    bit_unpack(packed, 8, bits, deltas);
+    delta_zigzag_decode(deltas, 8, restored, samples[0]);
+    std::cout << bits << " bits, " << words << " word(s), restored: ";
+    write_text(std::cout, restored, 8, " ");
+    std::cout << "\n";
+
+    // Nearest neighbours: the two database rows closest to a query
+    const float vectors[4][3] = {{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {0.9f, 0.1f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    const float query[3] = {1.0f, 0.2f, 0.0f};
+    const knn_database<float> database(&vectors[0][0], 4, 3);
+    std::size_t nearest[2] = {};
+    float nearest_distances[2] = {};
+    knn_search(query, 1, database, 2, distance_metric::l2, nearest, nearest_distances);
+    std::cout << "nearest rows: " << nearest[0] << " (" << nearest_distances[0] << "), " << nearest[1] << " (" << nearest_distances[1] << ")\n";
+
+    // Ring buffers: a block claimed, filled in place, committed, then acquired and reduced in place
+    spsc_ring<sample_block<float, 16>> ring(4);
+    const auto produced = ring.claim();
+    for (std::size_t i = 0; i < 16; ++i) { produced->data[i] = static_cast<float>(i); }
+    ring.commit(produced);
+    const auto consumed = ring.acquire();
+    std::cout << "block mean: " << mean(consumed->data, consumed->count) << "\n";
+    ring.release(consumed);
+
+    // Resampling: a chunk of 250 Hz samples converted to 1 kHz
+    polyphase_resampler<float> to_kilohertz(250, 1000);
+    std::vector<float> upsampled(to_kilohertz.max_output(8));
+    upsampled.resize(to_kilohertz.process(shaped.data, 8, upsampled.data()));
+    std::cout << upsampled.size() << " samples at 1 kHz, delay " << to_kilohertz.delay() << " input samples\n";
+
     return 0;
 
 }
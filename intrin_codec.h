@@ -0,0 +1,337 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Integer codecs for int16 / int32 sample streams: delta + zigzag, fixed width bit-packing, frame of reference.
+// usage: delta_zigzag_encode(samples, n, deltas);  const unsigned bits = max_bits(deltas, n);
+//        const std::size_t words = bit_pack(deltas, n, bits, packed);   // bit_unpack + delta_zigzag_decode reverse it
+//        const std::size_t used = frame_of_reference_encode(samples, n, packed);   // then
+//        if (frame_of_reference_decode(packed, used, n, samples) == codec_error) { /* corrupt or truncated */ }
+//
+// Every type works in 16 lanes of 32 bits (int16 / uint16 widened on load, truncated on store), so both widths
+// share one packed format. Bit-packing is vertical, as in SIMD-BP128: a block of 512 values is 32 rows of
+// 16 lanes, and lane k of the block's bit_width output words holds the rows of lane k back to back. The
+// per-width block kernels are fully unrolled, so every shift is an immediate. A last partial block is packed
+// as a plain little-endian bit stream. Frame of reference stores per 512-value block the minimum and the
+// bit width of (value - minimum), then the packed block. Invalid arguments and corrupt streams make the
+// functions that return a word count return codec_error instead.
+
+#ifndef INTRIN__INTRIN_CODEC_H
+#define INTRIN__INTRIN_CODEC_H
+
+#include "intrin_generic.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// word count returned for a bit width the value type cannot hold (bit_pack, bit_unpack) or a corrupt
+// stream (frame_of_reference_decode); never a real count, nothing is written past the last valid block
+constexpr std::size_t codec_error = static_cast<std::size_t>(-1);
+
+namespace intrin_detail {
+
+constexpr std::size_t codec_block = 512; // values per packed block: 32 rows x 16 lanes
+
+// 16 values as 32 bit lanes: signed types sign-extend, unsigned zero-extend
+inline __m512i load_lanes(const std::int32_t* p) { return _mm512_loadu_si512(p); }
+inline __m512i load_lanes(const std::uint32_t* p) { return _mm512_loadu_si512(p); }
+inline __m512i load_lanes(const std::int16_t* p) { return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))); }
+inline __m512i load_lanes(const std::uint16_t* p) { return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))); }
+
+template <typename T>
+__m512i load_lanes(const T* p, const std::size_t count) {
+    if (count >= 16) { return load_lanes(p); }
+    T part[16] = {};
+    std::memcpy(part, p, count * sizeof(T));
+    return load_lanes(part);
+}
+
+// the low bits of each lane into the first count values
+template <typename T>
+void store_lanes(T* p, const __m512i value, const std::size_t count = 16) {
+    const __mmask16 m = vec512<int>::up_to(count);
+    if constexpr (sizeof(T) == 4) {
+        _mm512_mask_storeu_epi32(p, m, value);
+    } else {
+        _mm512_mask_cvtepi32_storeu_epi16(p, m, value);
+    }
+}
+
+inline __m512i shift_lanes_up(const __m512i x, const int lanes_by) {
+    const __m512i zero = _mm512_setzero_si512();
+    switch (lanes_by) {
+        case 1: return _mm512_alignr_epi32(x, zero, 15);
+        case 2: return _mm512_alignr_epi32(x, zero, 14);
+        case 4: return _mm512_alignr_epi32(x, zero, 12);
+        default: return _mm512_alignr_epi32(x, zero, 8);
+    }
+}
+
+inline unsigned bits_needed(const std::uint32_t value) { return value ? 32u - static_cast<unsigned>(__builtin_clz(value)) : 0u; }
+
+template <unsigned Bits, typename T>
+void pack_block(const T* in, const __m512i reference, std::uint32_t* out) {
+    if constexpr (Bits > 0) {
+        const __m512i mask = _mm512_set1_epi32(static_cast<int>(Bits == 32 ? 0xffffffffu : (1u << Bits) - 1));
+        __m512i word = _mm512_setzero_si512();
+        unsigned shift = 0;
+#pragma GCC unroll 32
+        for (unsigned row = 0; row < 32; ++row) {
+            const __m512i v = _mm512_and_si512(_mm512_sub_epi32(load_lanes(in + 16 * row), reference), mask);
+            word = _mm512_or_si512(word, _mm512_slli_epi32(v, shift));
+            shift += Bits;
+            if (shift >= 32) {
+                _mm512_storeu_si512(out, word);
+                out += 16;
+                shift -= 32;
+                word = shift ? _mm512_srli_epi32(v, Bits - shift) : _mm512_setzero_si512();
+            }
+        }
+    }
+}
+
+template <unsigned Bits, typename T>
+void unpack_block(const std::uint32_t* in, const __m512i reference, T* out) {
+    if constexpr (Bits == 0) {
+#pragma GCC unroll 32
+        for (unsigned row = 0; row < 32; ++row) { store_lanes(out + 16 * row, reference); }
+    } else {
+        const __m512i mask = _mm512_set1_epi32(static_cast<int>(Bits == 32 ? 0xffffffffu : (1u << Bits) - 1));
+        __m512i word = _mm512_loadu_si512(in);
+        in += 16;
+        unsigned shift = 0;
+#pragma GCC unroll 32
+        for (unsigned row = 0; row < 32; ++row) {
+            __m512i v = _mm512_srli_epi32(word, shift);
+            if (shift + Bits >= 32) {
+                shift = shift + Bits - 32;
+                if (row != 31) {
+                    word = _mm512_loadu_si512(in);
+                    in += 16;
+                    if (shift) { v = _mm512_or_si512(v, _mm512_slli_epi32(word, Bits - shift)); }
+                }
+            } else {
+                shift += Bits;
+            }
+            store_lanes(out + 16 * row, _mm512_add_epi32(_mm512_and_si512(v, mask), reference));
+        }
+    }
+}
+
+template <typename T>
+using pack_function = void (*)(const T*, __m512i, std::uint32_t*);
+template <typename T>
+using unpack_function = void (*)(const std::uint32_t*, __m512i, T*);
+
+template <typename T, std::size_t... Bits>
+pack_function<T> pack_kernel(const unsigned bits, std::index_sequence<Bits...>) {
+    static constexpr pack_function<T> kernels[] = {&pack_block<Bits, T>...};
+    return kernels[bits];
+}
+
+template <typename T, std::size_t... Bits>
+unpack_function<T> unpack_kernel(const unsigned bits, std::index_sequence<Bits...>) {
+    static constexpr unpack_function<T> kernels[] = {&unpack_block<Bits, T>...};
+    return kernels[bits];
+}
+
+// partial block: (value - reference) as a little-endian bit stream
+template <typename T>
+std::size_t pack_stream(const T* in, const std::size_t n, const unsigned bits, const std::uint32_t reference, std::uint32_t* out) {
+    const std::uint64_t mask = bits == 32 ? 0xffffffffull : (1ull << bits) - 1;
+    std::uint64_t buffer = 0;
+    unsigned filled = 0;
+    std::size_t words = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        buffer |= ((static_cast<std::uint32_t>(static_cast<std::int32_t>(in[i])) - reference) & mask) << filled;
+        filled += bits;
+        if (filled >= 32) {
+            out[words++] = static_cast<std::uint32_t>(buffer);
+            buffer >>= 32;
+            filled -= 32;
+        }
+    }
+    if (filled) { out[words++] = static_cast<std::uint32_t>(buffer); }
+    return words;
+}
+
+template <typename T>
+std::size_t unpack_stream(const std::uint32_t* in, const std::size_t n, const unsigned bits, const std::uint32_t reference, T* out) {
+    const std::uint64_t mask = bits == 32 ? 0xffffffffull : (1ull << bits) - 1;
+    std::uint64_t buffer = 0;
+    unsigned filled = 0;
+    std::size_t words = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (filled < bits) {
+            buffer |= std::uint64_t(in[words++]) << filled;
+            filled += 32;
+        }
+        out[i] = static_cast<T>(static_cast<std::uint32_t>(buffer & mask) + reference);
+        buffer >>= bits;
+        filled -= bits;
+    }
+    return words;
+}
+
+template <typename T>
+std::size_t pack_values(const T* in, const std::size_t n, const unsigned bits, const std::uint32_t reference, std::uint32_t* out) {
+    const auto kernel = pack_kernel<T>(bits, std::make_index_sequence<33>());
+    const __m512i ref = _mm512_set1_epi32(static_cast<int>(reference));
+    std::size_t words = 0, i = 0;
+    for (; i + codec_block <= n; i += codec_block, words += 16 * bits) { kernel(in + i, ref, out + words); }
+    return words + pack_stream(in + i, n - i, bits, reference, out + words);
+}
+
+template <typename T>
+std::size_t unpack_values(const std::uint32_t* in, const std::size_t n, const unsigned bits, const std::uint32_t reference, T* out) {
+    const auto kernel = unpack_kernel<T>(bits, std::make_index_sequence<33>());
+    const __m512i ref = _mm512_set1_epi32(static_cast<int>(reference));
+    std::size_t words = 0, i = 0;
+    for (; i + codec_block <= n; i += codec_block, words += 16 * bits) { kernel(in + words, ref, out + i); }
+    return words + unpack_stream(in + words, n - i, bits, reference, out + i);
+}
+
+} // namespace intrin_detail
+
+/////////////////////// BUFFER FUNCTIONS - delta + zigzag (int16_t -> uint16_t, int32_t -> uint32_t)
+
+// out[i] = zigzag(in[i] - in[i - 1]), in[-1] = previous (the last sample of the preceding chunk)
+template <typename T>
+void delta_zigzag_encode(const T* in, const std::size_t n, std::make_unsigned_t<T>* out, const T previous = 0) {
+    static_assert(std::is_same_v<T, std::int16_t> || std::is_same_v<T, std::int32_t>, "int16_t or int32_t samples");
+    constexpr int narrow = 32 - 8 * static_cast<int>(sizeof(T));
+    __m512i carry = _mm512_set1_epi32(previous);
+    for (std::size_t i = 0; i < n; i += 16) {
+        const std::size_t count = n - i < 16 ? n - i : 16;
+        const __m512i x = intrin_detail::load_lanes(in + i, count);
+        __m512i delta = _mm512_sub_epi32(x, _mm512_alignr_epi32(x, carry, 15));
+        if constexpr (narrow > 0) { delta = _mm512_srai_epi32(_mm512_slli_epi32(delta, narrow), narrow); }
+        intrin_detail::store_lanes(out + i, _mm512_xor_si512(_mm512_slli_epi32(delta, 1), _mm512_srai_epi32(delta, 31)), count);
+        carry = x;
+    }
+}
+
+// inverse of delta_zigzag_encode: unzigzag, then a running sum carried across registers
+template <typename T>
+void delta_zigzag_decode(const std::make_unsigned_t<T>* in, const std::size_t n, T* out, const T previous = 0) {
+    static_assert(std::is_same_v<T, std::int16_t> || std::is_same_v<T, std::int32_t>, "int16_t or int32_t samples");
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i last = _mm512_set1_epi32(15);
+    __m512i carry = _mm512_set1_epi32(previous);
+    for (std::size_t i = 0; i < n; i += 16) {
+        const std::size_t count = n - i < 16 ? n - i : 16;
+        const __m512i z = intrin_detail::load_lanes(in + i, count);
+        __m512i x = _mm512_xor_si512(_mm512_srli_epi32(z, 1), _mm512_sub_epi32(_mm512_setzero_si512(), _mm512_and_si512(z, one)));
+        for (int by = 1; by < 16; by *= 2) { x = _mm512_add_epi32(x, intrin_detail::shift_lanes_up(x, by)); }
+        x = _mm512_add_epi32(x, carry);
+        intrin_detail::store_lanes(out + i, x, count);
+        carry = _mm512_permutexvar_epi32(last, x);
+    }
+}
+
+/////////////////////// BUFFER FUNCTIONS - bit-packing (uint16_t, uint32_t)
+
+// bits needed by the largest value (0 when all are zero)
+template <typename T>
+unsigned max_bits(const T* in, const std::size_t n) {
+    static_assert(std::is_same_v<T, std::uint16_t> || std::is_same_v<T, std::uint32_t>, "uint16_t or uint32_t values");
+    __m512i any = _mm512_setzero_si512();
+    for (std::size_t i = 0; i < n; i += 16) { any = _mm512_or_si512(any, intrin_detail::load_lanes(in + i, n - i)); }
+    return intrin_detail::bits_needed(static_cast<std::uint32_t>(_mm512_reduce_or_epi32(any)));
+}
+
+// 32 bit words bit_pack writes for n values of the given width
+inline std::size_t packed_words(const std::size_t n, const unsigned bits) {
+    return n / intrin_detail::codec_block * 16 * bits + ((n % intrin_detail::codec_block) * bits + 31) / 32;
+}
+
+// the low bits of every value (bits <= 32, <= 16 for uint16_t); returns the words written, codec_error
+// (and writes nothing) for a wider bits
+template <typename T>
+std::size_t bit_pack(const T* in, const std::size_t n, const unsigned bits, std::uint32_t* out) {
+    static_assert(std::is_same_v<T, std::uint16_t> || std::is_same_v<T, std::uint32_t>, "uint16_t or uint32_t values");
+    if (bits > 8 * sizeof(T)) { return codec_error; }
+    return intrin_detail::pack_values(in, n, bits, 0, out);
+}
+
+// returns the words read, codec_error (and writes nothing) for bits wider than T
+template <typename T>
+std::size_t bit_unpack(const std::uint32_t* in, const std::size_t n, const unsigned bits, T* out) {
+    static_assert(std::is_same_v<T, std::uint16_t> || std::is_same_v<T, std::uint32_t>, "uint16_t or uint32_t values");
+    if (bits > 8 * sizeof(T)) { return codec_error; }
+    return intrin_detail::unpack_values(in, n, bits, 0, out);
+}
+
+/////////////////////// BUFFER FUNCTIONS - frame of reference (int16_t, int32_t, uint16_t, uint32_t)
+
+// words frame_of_reference_encode may write for n values
+inline std::size_t frame_of_reference_bound(const std::size_t n) {
+    return (n + intrin_detail::codec_block - 1) / intrin_detail::codec_block * 2 + n;
+}
+
+// per block of 512 values: minimum, bit width, values - minimum packed; returns the words written
+template <typename T>
+std::size_t frame_of_reference_encode(const T* in, const std::size_t n, std::uint32_t* out) {
+    static_assert(std::is_integral_v<T> && (sizeof(T) == 2 || sizeof(T) == 4), "16 or 32 bit integers");
+    constexpr bool is_signed = std::is_signed_v<T>;
+    std::size_t words = 0;
+    for (std::size_t base = 0; base < n; base += intrin_detail::codec_block) {
+        const std::size_t count = n - base < intrin_detail::codec_block ? n - base : intrin_detail::codec_block;
+        // lanes past the end repeat the first value
+        const __m512i first = _mm512_set1_epi32(static_cast<int>(in[base]));
+        __m512i low = first, high = first;
+        for (std::size_t i = 0; i < count; i += 16) {
+            const __m512i x = _mm512_mask_mov_epi32(first, vec512<int>::up_to(count - i), intrin_detail::load_lanes(in + base + i, count - i));
+            low = is_signed ? _mm512_min_epi32(low, x) : _mm512_min_epu32(low, x);
+            high = is_signed ? _mm512_max_epi32(high, x) : _mm512_max_epu32(high, x);
+        }
+        const std::uint32_t minimum = static_cast<std::uint32_t>(is_signed ? _mm512_reduce_min_epi32(low) : static_cast<int>(_mm512_reduce_min_epu32(low)));
+        const std::uint32_t maximum = static_cast<std::uint32_t>(is_signed ? _mm512_reduce_max_epi32(high) : static_cast<int>(_mm512_reduce_max_epu32(high)));
+        const unsigned bits = intrin_detail::bits_needed(maximum - minimum);
+        out[words] = minimum;
+        out[words + 1] = bits;
+        words += 2 + intrin_detail::pack_values(in + base, count, bits, minimum, out + words + 2);
+    }
+    return words;
+}
+
+// reads at most in_words words; returns the words read, or codec_error at the first block whose header or
+// packed values would run past in_words, or whose bit width is larger than T (a truncated or corrupt
+// stream; the blocks before it are decoded)
+template <typename T>
+std::size_t frame_of_reference_decode(const std::uint32_t* in, const std::size_t in_words, const std::size_t n, T* out) {
+    static_assert(std::is_integral_v<T> && (sizeof(T) == 2 || sizeof(T) == 4), "16 or 32 bit integers");
+    std::size_t words = 0;
+    for (std::size_t base = 0; base < n; base += intrin_detail::codec_block) {
+        const std::size_t count = n - base < intrin_detail::codec_block ? n - base : intrin_detail::codec_block;
+        if (in_words - words < 2) { return codec_error; }
+        const std::uint32_t minimum = in[words];
+        const std::uint32_t bits = in[words + 1];
+        if (bits > 8 * sizeof(T) || in_words - words - 2 < packed_words(count, bits)) { return codec_error; }
+        words += 2 + intrin_detail::unpack_values(in + words + 2, count, bits, minimum, out + base);
+    }
+    return words;
+}
+
+#endif //INTRIN__INTRIN_CODEC_H
@@ -0,0 +1,585 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Complex vector types (interleaved: re, im, re, im, ...) and bulk functions over complex buffers.
+// usage: complex_float c = a * b.conj();  float_8_array_a32 power = c.norm();
+//        complex_multiply_accumulate(weights, samples, accumulator, count);  // std::complex<float>* buffers
+//
+// Multiplication is moveldup / movehdup / fmaddsub: re*re' - im*im' lands in the even (subtract)
+// lanes and re*im' + im*re' in the odd (add) lanes of a single fmaddsub.
+
+#ifndef INTRIN__INTRIN_COMPLEX_H
+#define INTRIN__INTRIN_COMPLEX_H
+
+#include "intrin_generic.h"
+#include <complex>
+#include <cstddef>
+#include <limits>
+
+namespace intrin_detail {
+
+inline __m512 complex_multiply(const __m512 a, const __m512 b) {
+    const __m512 b_re = _mm512_moveldup_ps(b);
+    const __m512 b_im = _mm512_movehdup_ps(b);
+    const __m512 a_swapped = _mm512_permute_ps(a, 0xB1); // (im, re) pairs
+    return _mm512_fmaddsub_ps(a, b_re, _mm512_mul_ps(a_swapped, b_im));
+}
+
+inline __m512d complex_multiply(const __m512d a, const __m512d b) {
+    const __m512d b_re = _mm512_movedup_pd(b);
+    const __m512d b_im = _mm512_permute_pd(b, 0xFF);
+    const __m512d a_swapped = _mm512_permute_pd(a, 0x55);
+    return _mm512_fmaddsub_pd(a, b_re, _mm512_mul_pd(a_swapped, b_im));
+}
+
+inline __m256 complex_multiply(const __m256 a, const __m256 b) {
+    const __m256 b_re = _mm256_moveldup_ps(b);
+    const __m256 b_im = _mm256_movehdup_ps(b);
+    const __m256 a_swapped = _mm256_permute_ps(a, 0xB1);
+    return _mm256_fmaddsub_ps(a, b_re, _mm256_mul_ps(a_swapped, b_im));
+}
+
+inline __m256d complex_multiply(const __m256d a, const __m256d b) {
+    const __m256d b_re = _mm256_movedup_pd(b);
+    const __m256d b_im = _mm256_permute_pd(b, 0xF);
+    const __m256d a_swapped = _mm256_permute_pd(a, 0x5);
+    return _mm256_fmaddsub_pd(a, b_re, _mm256_mul_pd(a_swapped, b_im));
+}
+
+// sign bit of every imaginary (odd) lane; the 512 bit xor goes through the integer domain,
+// since _mm512_xor_ps/pd need AVX512DQ
+inline __m512i imaginary_sign_512(const float) { return _mm512_set1_epi64(std::numeric_limits<long long int>::min()); }
+inline __m512i imaginary_sign_512(const double) {
+    const long long int sign = std::numeric_limits<long long int>::min();
+    return _mm512_set_epi64(sign, 0, sign, 0, sign, 0, sign, 0);
+}
+
+inline __m512 complex_conjugate(const __m512 a) {
+    return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), imaginary_sign_512(0.0f)));
+}
+inline __m512d complex_conjugate(const __m512d a) {
+    return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), imaginary_sign_512(0.0)));
+}
+inline __m256 complex_conjugate(const __m256 a) {
+    return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi64x(std::numeric_limits<long long int>::min())));
+}
+inline __m256d complex_conjugate(const __m256d a) {
+    return _mm256_xor_pd(a, _mm256_set_pd(-0.0, 0.0, -0.0, 0.0));
+}
+
+// |z|^2 of every pair, duplicated into both lanes of the pair
+inline __m512 complex_norm_pairs(const __m512 a) {
+    const __m512 squares = _mm512_mul_ps(a, a);
+    return _mm512_add_ps(squares, _mm512_permute_ps(squares, 0xB1));
+}
+inline __m512d complex_norm_pairs(const __m512d a) {
+    const __m512d squares = _mm512_mul_pd(a, a);
+    return _mm512_add_pd(squares, _mm512_permute_pd(squares, 0x55));
+}
+
+// even lanes to the low half, odd lanes to the high half (and back)
+inline __m512 split_lanes(const __m512 a) {
+    return _mm512_permutexvar_ps(_mm512_set_epi32(15, 13, 11, 9, 7, 5, 3, 1, 14, 12, 10, 8, 6, 4, 2, 0), a);
+}
+inline __m512 join_lanes(const __m512 a) {
+    return _mm512_permutexvar_ps(_mm512_set_epi32(15, 7, 14, 6, 13, 5, 12, 4, 11, 3, 10, 2, 9, 1, 8, 0), a);
+}
+inline __m512d split_lanes(const __m512d a) {
+    return _mm512_permutexvar_pd(_mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0), a);
+}
+inline __m512d join_lanes(const __m512d a) {
+    return _mm512_permutexvar_pd(_mm512_set_epi64(7, 3, 6, 2, 5, 1, 4, 0), a);
+}
+
+// two interleaved registers <-> one register of real parts and one of imaginary parts
+inline void deinterleave(const __m512 first, const __m512 second, __m512& re, __m512& im) {
+    const __m512i even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    re = _mm512_permutex2var_ps(first, even, second);
+    im = _mm512_permutex2var_ps(first, odd, second);
+}
+inline void deinterleave(const __m512d first, const __m512d second, __m512d& re, __m512d& im) {
+    const __m512i even = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i odd = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+    re = _mm512_permutex2var_pd(first, even, second);
+    im = _mm512_permutex2var_pd(first, odd, second);
+}
+inline void interleave(const __m512 re, const __m512 im, __m512& first, __m512& second) {
+    const __m512i low = _mm512_set_epi32(23, 7, 22, 6, 21, 5, 20, 4, 19, 3, 18, 2, 17, 1, 16, 0);
+    const __m512i high = _mm512_set_epi32(31, 15, 30, 14, 29, 13, 28, 12, 27, 11, 26, 10, 25, 9, 24, 8);
+    first = _mm512_permutex2var_ps(re, low, im);
+    second = _mm512_permutex2var_ps(re, high, im);
+}
+inline void interleave(const __m512d re, const __m512d im, __m512d& first, __m512d& second) {
+    const __m512i low = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+    const __m512i high = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+    first = _mm512_permutex2var_pd(re, low, im);
+    second = _mm512_permutex2var_pd(re, high, im);
+}
+
+} // namespace intrin_detail
+
+/////////////////////// COMPLEX FLOATING-POINT - interleaved complex<float> and complex<double>
+
+// Custom datatype for using 8 complex floats (16 floats, interleaved),  aligned at 64 byte boundary
+struct alignas(64) complex_float_8_array_a64 {
+    float data[16];
+    float& operator[](const int index) {
+        return data[index];
+    }
+    const float& operator[](const int index) const {
+        return data[index];
+    }
+
+    float& real(const int index) { return data[2 * index]; }
+    float& imag(const int index) { return data[2 * index + 1]; }
+    float real(const int index) const { return data[2 * index]; }
+    float imag(const int index) const { return data[2 * index + 1]; }
+
+    operator __m512() const {
+        return _mm512_load_ps(data);
+    }
+
+    complex_float_8_array_a64& operator=(const __m512 vec) {
+        _mm512_store_ps(data, vec);
+        return *this;
+    }
+
+    // ADDITION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_float_8_array_a64 operator+(const complex_float_8_array_a64& other) const {
+        complex_float_8_array_a64 res {};
+        res = _mm512_add_ps(*this, other);
+        return res;
+    }
+
+    // SUBTRACTION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_float_8_array_a64 operator-(const complex_float_8_array_a64& other) const {
+        complex_float_8_array_a64 res {};
+        res = _mm512_sub_ps(*this, other);
+        return res;
+    }
+
+    // COMPLEX MULTIPLICATION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_float_8_array_a64 operator*(const complex_float_8_array_a64& other) const {
+        complex_float_8_array_a64 res {};
+        res = intrin_detail::complex_multiply(static_cast<__m512>(*this), static_cast<__m512>(other));
+        return res;
+    }
+
+    complex_float_8_array_a64 conj() const {
+        complex_float_8_array_a64 res {};
+        res = intrin_detail::complex_conjugate(static_cast<__m512>(*this));
+        return res;
+    }
+
+    // magnitude squared, re^2 + im^2
+    float_8_array_a32 norm() const {
+        float_8_array_a32 res {};
+        res = _mm512_castps512_ps256(intrin_detail::split_lanes(intrin_detail::complex_norm_pairs(*this)));
+        return res;
+    }
+
+    void split(float_8_array_a32& re, float_8_array_a32& im) const {
+        const __m512 halves = intrin_detail::split_lanes(*this);
+        re = _mm512_castps512_ps256(halves);
+        im = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(halves), 1));
+    }
+
+    static complex_float_8_array_a64 from_split(const float_8_array_a32& re, const float_8_array_a32& im) {
+        const __m512d halves = _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(re)), _mm256_castps_pd(im), 1);
+        complex_float_8_array_a64 res {};
+        res = intrin_detail::join_lanes(_mm512_castpd_ps(halves));
+        return res;
+    }
+};
+
+// Custom datatype for using 4 complex doubles (8 doubles, interleaved),  aligned at 64 byte boundary
+struct alignas(64) complex_double_4_array_a64 {
+    double data[8];
+    double& operator[](const int index) {
+        return data[index];
+    }
+    const double& operator[](const int index) const {
+        return data[index];
+    }
+
+    double& real(const int index) { return data[2 * index]; }
+    double& imag(const int index) { return data[2 * index + 1]; }
+    double real(const int index) const { return data[2 * index]; }
+    double imag(const int index) const { return data[2 * index + 1]; }
+
+    operator __m512d() const {
+        return _mm512_load_pd(data);
+    }
+
+    complex_double_4_array_a64& operator=(const __m512d vec) {
+        _mm512_store_pd(data, vec);
+        return *this;
+    }
+
+    // ADDITION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_double_4_array_a64 operator+(const complex_double_4_array_a64& other) const {
+        complex_double_4_array_a64 res {};
+        res = _mm512_add_pd(*this, other);
+        return res;
+    }
+
+    // SUBTRACTION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_double_4_array_a64 operator-(const complex_double_4_array_a64& other) const {
+        complex_double_4_array_a64 res {};
+        res = _mm512_sub_pd(*this, other);
+        return res;
+    }
+
+    // COMPLEX MULTIPLICATION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_double_4_array_a64 operator*(const complex_double_4_array_a64& other) const {
+        complex_double_4_array_a64 res {};
+        res = intrin_detail::complex_multiply(static_cast<__m512d>(*this), static_cast<__m512d>(other));
+        return res;
+    }
+
+    complex_double_4_array_a64 conj() const {
+        complex_double_4_array_a64 res {};
+        res = intrin_detail::complex_conjugate(static_cast<__m512d>(*this));
+        return res;
+    }
+
+    // magnitude squared, re^2 + im^2
+    double_4_array_a32 norm() const {
+        double_4_array_a32 res {};
+        res = _mm512_castpd512_pd256(intrin_detail::split_lanes(intrin_detail::complex_norm_pairs(*this)));
+        return res;
+    }
+
+    void split(double_4_array_a32& re, double_4_array_a32& im) const {
+        const __m512d halves = intrin_detail::split_lanes(*this);
+        re = _mm512_castpd512_pd256(halves);
+        im = _mm512_extractf64x4_pd(halves, 1);
+    }
+
+    static complex_double_4_array_a64 from_split(const double_4_array_a32& re, const double_4_array_a32& im) {
+        complex_double_4_array_a64 res {};
+        res = intrin_detail::join_lanes(_mm512_insertf64x4(_mm512_castpd256_pd512(re), im, 1));
+        return res;
+    }
+};
+
+// Custom datatype for using 4 complex floats (8 floats, interleaved),  aligned at 32 byte boundary
+struct alignas(32) complex_float_4_array_a32 {
+    float data[8];
+    float& operator[](const int index) {
+        return data[index];
+    }
+    const float& operator[](const int index) const {
+        return data[index];
+    }
+
+    float& real(const int index) { return data[2 * index]; }
+    float& imag(const int index) { return data[2 * index + 1]; }
+    float real(const int index) const { return data[2 * index]; }
+    float imag(const int index) const { return data[2 * index + 1]; }
+
+    operator __m256() const {
+        return _mm256_load_ps(data);
+    }
+
+    complex_float_4_array_a32& operator=(const __m256 vec) {
+        _mm256_store_ps(data, vec);
+        return *this;
+    }
+
+    // ADDITION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_float_4_array_a32 operator+(const complex_float_4_array_a32& other) const {
+        complex_float_4_array_a32 res {};
+        res = _mm256_add_ps(*this, other);
+        return res;
+    }
+
+    // SUBTRACTION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_float_4_array_a32 operator-(const complex_float_4_array_a32& other) const {
+        complex_float_4_array_a32 res {};
+        res = _mm256_sub_ps(*this, other);
+        return res;
+    }
+
+    // COMPLEX MULTIPLICATION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_float_4_array_a32 operator*(const complex_float_4_array_a32& other) const {
+        complex_float_4_array_a32 res {};
+        res = intrin_detail::complex_multiply(static_cast<__m256>(*this), static_cast<__m256>(other));
+        return res;
+    }
+
+    complex_float_4_array_a32 conj() const {
+        complex_float_4_array_a32 res {};
+        res = intrin_detail::complex_conjugate(static_cast<__m256>(*this));
+        return res;
+    }
+
+    // magnitude squared, re^2 + im^2
+    float_4_array_a16 norm() const {
+        const __m256 squares = _mm256_mul_ps(*this, *this);
+        const __m256 halves = _mm256_permutevar8x32_ps(squares, _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0));
+        float_4_array_a16 res {};
+        res = _mm_add_ps(_mm256_castps256_ps128(halves), _mm256_extractf128_ps(halves, 1));
+        return res;
+    }
+
+    void split(float_4_array_a16& re, float_4_array_a16& im) const {
+        const __m256 halves = _mm256_permutevar8x32_ps(*this, _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0));
+        re = _mm256_castps256_ps128(halves);
+        im = _mm256_extractf128_ps(halves, 1);
+    }
+
+    static complex_float_4_array_a32 from_split(const float_4_array_a16& re, const float_4_array_a16& im) {
+        complex_float_4_array_a32 res {};
+        res = _mm256_permutevar8x32_ps(_mm256_set_m128(im, re), _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0));
+        return res;
+    }
+};
+
+// Custom datatype for using 2 complex doubles (4 doubles, interleaved),  aligned at 32 byte boundary
+struct alignas(32) complex_double_2_array_a32 {
+    double data[4];
+    double& operator[](const int index) {
+        return data[index];
+    }
+    const double& operator[](const int index) const {
+        return data[index];
+    }
+
+    double& real(const int index) { return data[2 * index]; }
+    double& imag(const int index) { return data[2 * index + 1]; }
+    double real(const int index) const { return data[2 * index]; }
+    double imag(const int index) const { return data[2 * index + 1]; }
+
+    operator __m256d() const {
+        return _mm256_load_pd(data);
+    }
+
+    complex_double_2_array_a32& operator=(const __m256d vec) {
+        _mm256_store_pd(data, vec);
+        return *this;
+    }
+
+    // ADDITION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_double_2_array_a32 operator+(const complex_double_2_array_a32& other) const {
+        complex_double_2_array_a32 res {};
+        res = _mm256_add_pd(*this, other);
+        return res;
+    }
+
+    // SUBTRACTION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_double_2_array_a32 operator-(const complex_double_2_array_a32& other) const {
+        complex_double_2_array_a32 res {};
+        res = _mm256_sub_pd(*this, other);
+        return res;
+    }
+
+    // COMPLEX MULTIPLICATION OPERATOR OVERLOADED (MATCHES TYPES)
+    complex_double_2_array_a32 operator*(const complex_double_2_array_a32& other) const {
+        complex_double_2_array_a32 res {};
+        res = intrin_detail::complex_multiply(static_cast<__m256d>(*this), static_cast<__m256d>(other));
+        return res;
+    }
+
+    complex_double_2_array_a32 conj() const {
+        complex_double_2_array_a32 res {};
+        res = intrin_detail::complex_conjugate(static_cast<__m256d>(*this));
+        return res;
+    }
+
+    // magnitude squared, re^2 + im^2
+    double_2_array_a16 norm() const {
+        const __m256d halves = _mm256_permute4x64_pd(_mm256_mul_pd(*this, *this), 0xD8); // re re im im
+        double_2_array_a16 res {};
+        res = _mm_add_pd(_mm256_castpd256_pd128(halves), _mm256_extractf128_pd(halves, 1));
+        return res;
+    }
+
+    void split(double_2_array_a16& re, double_2_array_a16& im) const {
+        const __m256d halves = _mm256_permute4x64_pd(*this, 0xD8);
+        re = _mm256_castpd256_pd128(halves);
+        im = _mm256_extractf128_pd(halves, 1);
+    }
+
+    static complex_double_2_array_a32 from_split(const double_2_array_a16& re, const double_2_array_a16& im) {
+        complex_double_2_array_a32 res {};
+        res = _mm256_permute4x64_pd(_mm256_set_m128d(im, re), 0xD8);
+        return res;
+    }
+};
+
+using complex_float = complex_float_8_array_a64;
+using complex_double = complex_double_4_array_a64;
+
+/////////////////////// BUFFER FUNCTIONS - std::complex<float> and std::complex<double> (interleaved)
+
+// out[i] = a[i] * b[i]
+template <typename T>
+void complex_multiply(const std::complex<T>* a, const std::complex<T>* b, std::complex<T>* out, const std::size_t count) {
+    using V = vec512<T>;
+    const T* a_raw = reinterpret_cast<const T*>(a);
+    const T* b_raw = reinterpret_cast<const T*>(b);
+    T* out_raw = reinterpret_cast<T*>(out);
+    const std::size_t scalars = 2 * count;
+    for (std::size_t i = 0; i < scalars; i += V::lanes) {
+        const auto m = V::up_to(scalars - i);
+        V::storeu(out_raw + i, intrin_detail::complex_multiply(V::loadu(a_raw + i, m), V::loadu(b_raw + i, m)), m);
+    }
+}
+
+// accumulator[i] += a[i] * b[i]
+template <typename T>
+void complex_multiply_accumulate(const std::complex<T>* a, const std::complex<T>* b, std::complex<T>* accumulator,
+                                 const std::size_t count) {
+    using V = vec512<T>;
+    const T* a_raw = reinterpret_cast<const T*>(a);
+    const T* b_raw = reinterpret_cast<const T*>(b);
+    T* acc_raw = reinterpret_cast<T*>(accumulator);
+    const std::size_t scalars = 2 * count;
+    for (std::size_t i = 0; i < scalars; i += V::lanes) {
+        const auto m = V::up_to(scalars - i);
+        const auto product = intrin_detail::complex_multiply(V::loadu(a_raw + i, m), V::loadu(b_raw + i, m));
+        V::storeu(acc_raw + i, V::add(V::loadu(acc_raw + i, m), product), m);
+    }
+}
+
+// accumulator[i] += a[i] * b[i] with the real and imaginary parts in separate buffers (split layout)
+template <typename T>
+void complex_multiply_accumulate_split(const T* a_re, const T* a_im, const T* b_re, const T* b_im,
+                                       T* acc_re, T* acc_im, const std::size_t count) {
+    using V = vec512<T>;
+    for (std::size_t i = 0; i < count; i += V::lanes) {
+        const auto m = V::up_to(count - i);
+        const auto ar = V::loadu(a_re + i, m), ai = V::loadu(a_im + i, m);
+        const auto br = V::loadu(b_re + i, m), bi = V::loadu(b_im + i, m);
+        const auto re = V::fmadd(ar, br, V::loadu(acc_re + i, m));
+        const auto im = V::fmadd(ar, bi, V::loadu(acc_im + i, m));
+        V::storeu(acc_re + i, V::sub(re, V::mul(ai, bi)), m);
+        V::storeu(acc_im + i, V::fmadd(ai, br, im), m);
+    }
+}
+
+namespace intrin_detail {
+
+template <bool Conjugate, typename T>
+std::complex<T> complex_dot(const std::complex<T>* a, const std::complex<T>* b, const std::size_t count) {
+    using V = vec512<T>;
+    const T* a_raw = reinterpret_cast<const T*>(a);
+    const T* b_raw = reinterpret_cast<const T*>(b);
+    const std::size_t scalars = 2 * count;
+    auto sum = V::zero();
+    for (std::size_t i = 0; i < scalars; i += V::lanes) {
+        const auto m = V::up_to(scalars - i);
+        auto a_vec = V::loadu(a_raw + i, m);
+        if (Conjugate) { a_vec = complex_conjugate(a_vec); }
+        sum = V::add(sum, complex_multiply(a_vec, V::loadu(b_raw + i, m)));
+    }
+    alignas(64) T lanes[V::lanes];
+    V::storeu(lanes, sum);
+    T re = 0, im = 0;
+    for (int lane = 0; lane < V::lanes; lane += 2) {
+        re += lanes[lane];
+        im += lanes[lane + 1];
+    }
+    return {re, im};
+}
+
+} // namespace intrin_detail
+
+// sum of a[i] * b[i]
+template <typename T>
+std::complex<T> complex_dot(const std::complex<T>* a, const std::complex<T>* b, const std::size_t count) {
+    return intrin_detail::complex_dot<false>(a, b, count);
+}
+
+// sum of conj(a[i]) * b[i], the beamformer / correlation form
+template <typename T>
+std::complex<T> complex_vdot(const std::complex<T>* a, const std::complex<T>* b, const std::size_t count) {
+    return intrin_detail::complex_dot<true>(a, b, count);
+}
+
+// out[i] = conj(a[i]); a and out may be the same buffer
+template <typename T>
+void complex_conjugate(const std::complex<T>* a, std::complex<T>* out, const std::size_t count) {
+    using V = vec512<T>;
+    const T* a_raw = reinterpret_cast<const T*>(a);
+    T* out_raw = reinterpret_cast<T*>(out);
+    const std::size_t scalars = 2 * count;
+    for (std::size_t i = 0; i < scalars; i += V::lanes) {
+        const auto m = V::up_to(scalars - i);
+        V::storeu(out_raw + i, intrin_detail::complex_conjugate(V::loadu(a_raw + i, m)), m);
+    }
+}
+
+// out[i] = |a[i]|^2, into a real buffer
+template <typename T>
+void complex_norm(const std::complex<T>* a, T* out, const std::size_t count) {
+    using V = vec512<T>;
+    constexpr int pairs = V::lanes / 2;
+    const T* a_raw = reinterpret_cast<const T*>(a);
+    for (std::size_t i = 0; i < count; i += pairs) {
+        const std::size_t left = count - i;
+        const auto m = V::up_to(2 * left);
+        const auto norms = intrin_detail::split_lanes(intrin_detail::complex_norm_pairs(V::loadu(a_raw + 2 * i, m)));
+        V::storeu(out + i, norms, V::tail(left < static_cast<std::size_t>(pairs) ? left : pairs));
+    }
+}
+
+// interleaved -> split layout
+template <typename T>
+void complex_deinterleave(const std::complex<T>* a, T* re, T* im, const std::size_t count) {
+    using V = vec512<T>;
+    const T* a_raw = reinterpret_cast<const T*>(a);
+    std::size_t i = 0;
+    for (; i + V::lanes <= count; i += V::lanes) {
+        typename V::reg re_vec, im_vec;
+        intrin_detail::deinterleave(V::loadu(a_raw + 2 * i), V::loadu(a_raw + 2 * i + V::lanes), re_vec, im_vec);
+        V::storeu(re + i, re_vec);
+        V::storeu(im + i, im_vec);
+    }
+    for (; i < count; ++i) {
+        re[i] = a_raw[2 * i];
+        im[i] = a_raw[2 * i + 1];
+    }
+}
+
+// split -> interleaved layout
+template <typename T>
+void complex_interleave(const T* re, const T* im, std::complex<T>* out, const std::size_t count) {
+    using V = vec512<T>;
+    T* out_raw = reinterpret_cast<T*>(out);
+    std::size_t i = 0;
+    for (; i + V::lanes <= count; i += V::lanes) {
+        typename V::reg first, second;
+        intrin_detail::interleave(V::loadu(re + i), V::loadu(im + i), first, second);
+        V::storeu(out_raw + 2 * i, first);
+        V::storeu(out_raw + 2 * i + V::lanes, second);
+    }
+    for (; i < count; ++i) {
+        out_raw[2 * i] = re[i];
+        out_raw[2 * i + 1] = im[i];
+    }
+}
+
+#endif //INTRIN__INTRIN_COMPLEX_H
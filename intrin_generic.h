@@ -49,6 +49,8 @@ The version can be changed in the CMakeLists.txt to C++ version as per user's pr
 #define INTRIN_INTRIN_GENERIC_H
 
 #include <immintrin.h>
+#include <cstddef>
+#include <new>
 #include "intrin_print.h" //houses the auto-detect print for any array or structure having an array
 
 // #pragma GCC target("axv512f")
@@ -929,6 +931,191 @@ struct alignas(32) double_8_array_a32 {
     }
 };
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/////////////////////// LANE TRAITS - used by the bulk (buffer) functions of the other headers
+
+// vec512<T> maps an element type onto its 512 bit register and the handful of intrinsics
+// the buffer kernels need, so that one template serves float, double, int and long long.
+// The tail(n) mask selects the first n lanes (n < lanes), for the leftover elements of a buffer;
+// up_to(n) is the same but gives the full mask for n >= lanes.
+template <typename T>
+struct vec512;
+
+template <>
+struct vec512<float> {
+    using reg = __m512;
+    using mask = __mmask16;
+    static constexpr int lanes = 16;
+
+    static reg load(const float* ptr) { return _mm512_load_ps(ptr); }
+    static reg loadu(const float* ptr) { return _mm512_loadu_ps(ptr); }
+    static reg loadu(const float* ptr, const mask m) { return _mm512_maskz_loadu_ps(m, ptr); }
+    static void storeu(float* ptr, const reg vec) { _mm512_storeu_ps(ptr, vec); }
+    static void storeu(float* ptr, const reg vec, const mask m) { _mm512_mask_storeu_ps(ptr, m, vec); }
+    static reg set1(const float value) { return _mm512_set1_ps(value); }
+    static reg zero() { return _mm512_setzero_ps(); }
+
+    static reg add(const reg a, const reg b) { return _mm512_add_ps(a, b); }
+    static reg sub(const reg a, const reg b) { return _mm512_sub_ps(a, b); }
+    static reg mul(const reg a, const reg b) { return _mm512_mul_ps(a, b); }
+    static reg div(const reg a, const reg b) { return _mm512_div_ps(a, b); }
+    static reg fmadd(const reg a, const reg b, const reg c) { return _mm512_fmadd_ps(a, b, c); }
+    static reg min(const reg a, const reg b) { return _mm512_min_ps(a, b); }
+    static reg max(const reg a, const reg b) { return _mm512_max_ps(a, b); }
+    static reg blend(const mask m, const reg a, const reg b) { return _mm512_mask_blend_ps(m, a, b); }
+
+    static mask cmp_lt(const reg a, const reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static mask cmp_le(const reg a, const reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static mask cmp_gt(const reg a, const reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static mask cmp_eq(const reg a, const reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+
+    static float reduce_add(const reg vec) { return _mm512_reduce_add_ps(vec); }
+    static float reduce_min(const reg vec) { return _mm512_reduce_min_ps(vec); }
+    static float reduce_max(const reg vec) { return _mm512_reduce_max_ps(vec); }
+
+    static reg permute(const __m512i index, const reg vec) { return _mm512_permutexvar_ps(index, vec); }
+    static void compress_storeu(float* ptr, const mask m, const reg vec) { _mm512_mask_compressstoreu_ps(ptr, m, vec); }
+    static mask tail(const std::size_t count) { return static_cast<mask>((1u << count) - 1u); }
+    static mask up_to(const std::size_t remaining) { return remaining >= lanes ? static_cast<mask>(~mask(0)) : tail(remaining); }
+};
+
+template <>
+struct vec512<double> {
+    using reg = __m512d;
+    using mask = __mmask8;
+    static constexpr int lanes = 8;
+
+    static reg load(const double* ptr) { return _mm512_load_pd(ptr); }
+    static reg loadu(const double* ptr) { return _mm512_loadu_pd(ptr); }
+    static reg loadu(const double* ptr, const mask m) { return _mm512_maskz_loadu_pd(m, ptr); }
+    static void storeu(double* ptr, const reg vec) { _mm512_storeu_pd(ptr, vec); }
+    static void storeu(double* ptr, const reg vec, const mask m) { _mm512_mask_storeu_pd(ptr, m, vec); }
+    static reg set1(const double value) { return _mm512_set1_pd(value); }
+    static reg zero() { return _mm512_setzero_pd(); }
+
+    static reg add(const reg a, const reg b) { return _mm512_add_pd(a, b); }
+    static reg sub(const reg a, const reg b) { return _mm512_sub_pd(a, b); }
+    static reg mul(const reg a, const reg b) { return _mm512_mul_pd(a, b); }
+    static reg div(const reg a, const reg b) { return _mm512_div_pd(a, b); }
+    static reg fmadd(const reg a, const reg b, const reg c) { return _mm512_fmadd_pd(a, b, c); }
+    static reg min(const reg a, const reg b) { return _mm512_min_pd(a, b); }
+    static reg max(const reg a, const reg b) { return _mm512_max_pd(a, b); }
+    static reg blend(const mask m, const reg a, const reg b) { return _mm512_mask_blend_pd(m, a, b); }
+
+    static mask cmp_lt(const reg a, const reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static mask cmp_le(const reg a, const reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+    static mask cmp_gt(const reg a, const reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+    static mask cmp_eq(const reg a, const reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+
+    static double reduce_add(const reg vec) { return _mm512_reduce_add_pd(vec); }
+    static double reduce_min(const reg vec) { return _mm512_reduce_min_pd(vec); }
+    static double reduce_max(const reg vec) { return _mm512_reduce_max_pd(vec); }
+
+    static reg permute(const __m512i index, const reg vec) { return _mm512_permutexvar_pd(index, vec); }
+    static void compress_storeu(double* ptr, const mask m, const reg vec) { _mm512_mask_compressstoreu_pd(ptr, m, vec); }
+    static mask tail(const std::size_t count) { return static_cast<mask>((1u << count) - 1u); }
+    static mask up_to(const std::size_t remaining) { return remaining >= lanes ? static_cast<mask>(~mask(0)) : tail(remaining); }
+};
+
+template <>
+struct vec512<int> {
+    using reg = __m512i;
+    using mask = __mmask16;
+    static constexpr int lanes = 16;
+
+    static reg load(const int* ptr) { return _mm512_load_si512(ptr); }
+    static reg loadu(const int* ptr) { return _mm512_loadu_si512(ptr); }
+    static reg loadu(const int* ptr, const mask m) { return _mm512_maskz_loadu_epi32(m, ptr); }
+    static void storeu(int* ptr, const reg vec) { _mm512_storeu_si512(ptr, vec); }
+    static void storeu(int* ptr, const reg vec, const mask m) { _mm512_mask_storeu_epi32(ptr, m, vec); }
+    static reg set1(const int value) { return _mm512_set1_epi32(value); }
+    static reg zero() { return _mm512_setzero_si512(); }
+
+    static reg add(const reg a, const reg b) { return _mm512_add_epi32(a, b); }
+    static reg sub(const reg a, const reg b) { return _mm512_sub_epi32(a, b); }
+    static reg mul(const reg a, const reg b) { return _mm512_mullo_epi32(a, b); }
+    static reg min(const reg a, const reg b) { return _mm512_min_epi32(a, b); }
+    static reg max(const reg a, const reg b) { return _mm512_max_epi32(a, b); }
+    static reg blend(const mask m, const reg a, const reg b) { return _mm512_mask_blend_epi32(m, a, b); }
+
+    static mask cmp_lt(const reg a, const reg b) { return _mm512_cmplt_epi32_mask(a, b); }
+    static mask cmp_le(const reg a, const reg b) { return _mm512_cmple_epi32_mask(a, b); }
+    static mask cmp_gt(const reg a, const reg b) { return _mm512_cmpgt_epi32_mask(a, b); }
+    static mask cmp_eq(const reg a, const reg b) { return _mm512_cmpeq_epi32_mask(a, b); }
+
+    static int reduce_add(const reg vec) { return _mm512_reduce_add_epi32(vec); }
+    static int reduce_min(const reg vec) { return _mm512_reduce_min_epi32(vec); }
+    static int reduce_max(const reg vec) { return _mm512_reduce_max_epi32(vec); }
+
+    static reg permute(const __m512i index, const reg vec) { return _mm512_permutexvar_epi32(index, vec); }
+    static void compress_storeu(int* ptr, const mask m, const reg vec) { _mm512_mask_compressstoreu_epi32(ptr, m, vec); }
+    static mask tail(const std::size_t count) { return static_cast<mask>((1u << count) - 1u); }
+    static mask up_to(const std::size_t remaining) { return remaining >= lanes ? static_cast<mask>(~mask(0)) : tail(remaining); }
+};
+
+template <>
+struct vec512<long long int> {
+    using reg = __m512i;
+    using mask = __mmask8;
+    static constexpr int lanes = 8;
+
+    static reg load(const long long int* ptr) { return _mm512_load_si512(ptr); }
+    static reg loadu(const long long int* ptr) { return _mm512_loadu_si512(ptr); }
+    static reg loadu(const long long int* ptr, const mask m) { return _mm512_maskz_loadu_epi64(m, ptr); }
+    static void storeu(long long int* ptr, const reg vec) { _mm512_storeu_si512(ptr, vec); }
+    static void storeu(long long int* ptr, const reg vec, const mask m) { _mm512_mask_storeu_epi64(ptr, m, vec); }
+    static reg set1(const long long int value) { return _mm512_set1_epi64(value); }
+    static reg zero() { return _mm512_setzero_si512(); }
+
+    static reg add(const reg a, const reg b) { return _mm512_add_epi64(a, b); }
+    static reg sub(const reg a, const reg b) { return _mm512_sub_epi64(a, b); }
+    static reg mul(const reg a, const reg b) { return _mm512_mullox_epi64(a, b); } // AVX512F sequence, no DQ needed
+    static reg min(const reg a, const reg b) { return _mm512_min_epi64(a, b); }
+    static reg max(const reg a, const reg b) { return _mm512_max_epi64(a, b); }
+    static reg blend(const mask m, const reg a, const reg b) { return _mm512_mask_blend_epi64(m, a, b); }
+
+    static mask cmp_lt(const reg a, const reg b) { return _mm512_cmplt_epi64_mask(a, b); }
+    static mask cmp_le(const reg a, const reg b) { return _mm512_cmple_epi64_mask(a, b); }
+    static mask cmp_gt(const reg a, const reg b) { return _mm512_cmpgt_epi64_mask(a, b); }
+    static mask cmp_eq(const reg a, const reg b) { return _mm512_cmpeq_epi64_mask(a, b); }
+
+    static long long int reduce_add(const reg vec) { return _mm512_reduce_add_epi64(vec); }
+    static long long int reduce_min(const reg vec) { return _mm512_reduce_min_epi64(vec); }
+    static long long int reduce_max(const reg vec) { return _mm512_reduce_max_epi64(vec); }
+
+    static reg permute(const __m512i index, const reg vec) { return _mm512_permutexvar_epi64(index, vec); }
+    static void compress_storeu(long long int* ptr, const mask m, const reg vec) { _mm512_mask_compressstoreu_epi64(ptr, m, vec); }
+    static mask tail(const std::size_t count) { return static_cast<mask>((1u << count) - 1u); }
+    static mask up_to(const std::size_t remaining) { return remaining >= lanes ? static_cast<mask>(~mask(0)) : tail(remaining); }
+};
+
+/////////////////////// ALIGNED STORAGE
+
+// allocator handing out Alignment-aligned blocks: std::vector<T, aligned_allocator<T>> can feed the
+// aligned loads of the vector types (and the bulk functions) directly
+template <typename T, std::size_t Alignment = 64>
+struct aligned_allocator {
+    using value_type = T;
+    template <typename U>
+    struct rebind { using other = aligned_allocator<U, Alignment>; };
+
+    aligned_allocator() noexcept = default;
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept {}
+
+    T* allocate(const std::size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T* ptr, std::size_t) noexcept { ::operator delete(ptr, std::align_val_t(Alignment)); }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator==(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept { return true; }
+template <typename T, typename U, std::size_t Alignment>
+bool operator!=(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept { return false; }
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,396 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// 2-D plane kernels over row-major float and uint8 planes: separable convolution, box and gaussian blur,
+// bilinear and area resize.
+// usage: const image_plane<const std::uint8_t> src {pixels, width, height, stride};
+//        image_plane<std::uint8_t> dst {out, width, height, width};   gaussian_blur(src, dst, 1.5f);
+//
+// Strides count elements. Borders replicate the edge pixels: rows are copied into a padded float row
+// whose margins are filled with whole-register stores, and the vertical taps use clamped row pointers,
+// so the inner loops never test coordinates. Separable filters work in horizontal strips whose
+// intermediate rows fit in tuning().tile_bytes (intrin_tune.h). uint8 results are rounded to nearest and saturated.
+// Source and destination must not overlap.
+
+#ifndef INTRIN__INTRIN_IMAGE_H
+#define INTRIN__INTRIN_IMAGE_H
+
+#include "intrin_generic.h"
+#include "intrin_tune.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+struct image_plane {
+    T* data;
+    std::size_t width;
+    std::size_t height;
+    std::size_t stride; // elements from one row to the next
+
+    T* row(const std::size_t y) const { return data + y * stride; }
+
+    // a writable plane also serves as a read-only one
+    operator image_plane<const T>() const { return {data, width, height, stride}; }
+};
+
+namespace intrin_detail {
+
+using float_row = std::vector<float, aligned_allocator<float>>;
+
+inline void row_to_float(const float* src, float* dst, const std::size_t width) {
+    std::memcpy(dst, src, width * sizeof(float));
+}
+
+inline void row_to_float(const std::uint8_t* src, float* dst, const std::size_t width) {
+    std::size_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        _mm512_storeu_ps(dst + x, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes)));
+    }
+    if (x < width) {
+        alignas(16) std::uint8_t tail[16] = {};
+        std::memcpy(tail, src + x, width - x);
+        const __m512 values = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(tail))));
+        _mm512_mask_storeu_ps(dst + x, vec512<float>::tail(width - x), values);
+    }
+}
+
+inline void row_to_int(const std::uint8_t* src, int* dst, const std::size_t width) {
+    std::size_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        _mm512_storeu_si512(dst + x, _mm512_cvtepu8_epi32(bytes));
+    }
+    for (; x < width; ++x) { dst[x] = src[x]; }
+}
+
+inline void store_pixels(float* dst, const __m512 value, const __mmask16 m) { _mm512_mask_storeu_ps(dst, m, value); }
+
+inline void store_pixels(std::uint8_t* dst, const __m512 value, const __mmask16 m) {
+    __m512i rounded = _mm512_cvtps_epi32(value);
+    rounded = _mm512_min_epi32(_mm512_max_epi32(rounded, _mm512_setzero_si512()), _mm512_set1_epi32(255));
+    _mm512_mask_cvtepi32_storeu_epi8(dst, m, rounded);
+}
+
+// the row as floats at padded + radius, its first / last pixel repeated radius times on either side
+template <typename T>
+void pad_row(const T* src, const std::size_t width, const std::size_t radius, float* padded) {
+    using V = vec512<float>;
+    row_to_float(src, padded + radius, width);
+    const auto left = V::set1(padded[radius]);
+    const auto right = V::set1(padded[radius + width - 1]);
+    for (std::size_t x = 0; x < radius; x += V::lanes) {
+        const auto m = V::up_to(radius - x);
+        V::storeu(padded + x, left, m);
+        V::storeu(padded + radius + width + x, right, m);
+    }
+}
+
+// out[x] = sum_j kernel[j] * padded[x + j], j < 2 * radius + 1
+inline void convolve_row(const float* padded, const std::size_t width, const float* kernel, const std::size_t taps, float* out) {
+    using V = vec512<float>;
+    for (std::size_t x = 0; x < width; x += V::lanes) {
+        const auto m = V::up_to(width - x);
+        auto sum = V::zero();
+        for (std::size_t j = 0; j < taps; ++j) { sum = V::fmadd(V::set1(kernel[j]), V::loadu(padded + x + j, m), sum); }
+        V::storeu(out + x, sum, m);
+    }
+}
+
+inline std::size_t clamp_row(const long long y, const std::size_t height) {
+    return y < 0 ? 0 : (static_cast<std::size_t>(y) >= height ? height - 1 : static_cast<std::size_t>(y));
+}
+
+inline std::size_t round_up_lanes(const std::size_t count) { return (count + 15) / 16 * 16; }
+
+// rows per strip so that the strip's intermediate rows take about tuning().tile_bytes
+inline std::size_t strip_rows(const std::size_t width, const std::size_t halo) {
+    const std::size_t rows = tuning().tile_bytes / (round_up_lanes(width) * sizeof(float));
+    return rows > halo + 8 ? rows - halo : 8;
+}
+
+// H[x] = sum of padded[x .. x + window - 1] for x < width, by doubling: partial sums over 1, 2, 4 ...
+// elements, the ones in the binary expansion of window added at increasing offsets (window - 1 adds
+// turned into about 2 log2(window) register passes, exact for integers)
+template <typename A>
+void box_row(A* padded, const std::size_t width, const std::size_t window, A* out) {
+    using V = vec512<A>;
+    const std::size_t length = width + window - 1;
+    for (std::size_t x = 0; x < width; x += V::lanes) { V::storeu(out + x, V::zero(), V::up_to(width - x)); }
+
+    std::size_t offset = 0;
+    for (std::size_t span = 1; span <= window; span *= 2) {
+        if (window & span) {
+            for (std::size_t x = 0; x < width; x += V::lanes) {
+                const auto m = V::up_to(width - x);
+                V::storeu(out + x, V::add(V::loadu(out + x, m), V::loadu(padded + offset + x, m)), m);
+            }
+            offset += span;
+        }
+        if (span * 2 <= window) {
+            // padded[x] += padded[x + span], ascending so every read sees the previous level
+            const std::size_t valid = length - 2 * span + 1;
+            for (std::size_t x = 0; x < valid; x += V::lanes) {
+                const auto m = V::up_to(valid - x);
+                V::storeu(padded + x, V::add(V::loadu(padded + x, m), V::loadu(padded + x + span, m)), m);
+            }
+        }
+    }
+}
+
+template <typename A, typename T>
+void box_pad_row(const T* src, const std::size_t width, const std::size_t radius, A* padded) {
+    using V = vec512<A>;
+    if constexpr (std::is_same_v<A, int>) {
+        row_to_int(src, padded + radius, width);
+    } else {
+        row_to_float(src, padded + radius, width);
+    }
+    const auto left = V::set1(padded[radius]);
+    const auto right = V::set1(padded[radius + width - 1]);
+    for (std::size_t x = 0; x < radius; x += V::lanes) {
+        const auto m = V::up_to(radius - x);
+        V::storeu(padded + x, left, m);
+        V::storeu(padded + radius + width + x, right, m);
+    }
+}
+
+inline __m512 to_float(const __m512 value) { return value; }
+inline __m512 to_float(const __m512i value) { return _mm512_cvtepi32_ps(value); }
+
+// source positions of a resize, per output coordinate: first source index and the tap weights,
+// stored tap-major (weights[t * count + i]) so a register of outputs loads each tap contiguously
+struct resize_taps {
+    std::size_t taps = 0;
+    std::vector<int, aligned_allocator<int>> index;
+    std::vector<float, aligned_allocator<float>> weights;
+};
+
+// bilinear with pixel centres at +0.5: two taps
+inline resize_taps bilinear_taps(const std::size_t source, const std::size_t count) {
+    resize_taps result;
+    result.taps = 2;
+    result.index.resize(2 * count);
+    result.weights.resize(2 * count);
+    const double scale = double(source) / double(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        double position = (double(i) + 0.5) * scale - 0.5;
+        position = position < 0 ? 0 : (position > double(source - 1) ? double(source - 1) : position);
+        const std::size_t first = static_cast<std::size_t>(position);
+        const double fraction = position - double(first);
+        result.index[i] = static_cast<int>(first);
+        result.index[count + i] = static_cast<int>(first + 1 < source ? first + 1 : first);
+        result.weights[i] = float(1.0 - fraction);
+        result.weights[count + i] = float(fraction);
+    }
+    return result;
+}
+
+// area: output i covers [i * scale, (i + 1) * scale) of the source, each source pixel weighted by its overlap
+inline resize_taps area_taps(const std::size_t source, const std::size_t count) {
+    resize_taps result;
+    const double scale = double(source) / double(count);
+    result.taps = static_cast<std::size_t>(std::ceil(scale)) + 1;
+    result.index.assign(result.taps * count, 0);
+    result.weights.assign(result.taps * count, 0.0f);
+    for (std::size_t i = 0; i < count; ++i) {
+        const double begin = double(i) * scale;
+        const double end = double(i + 1) * scale;
+        const std::size_t first = static_cast<std::size_t>(begin);
+        for (std::size_t t = 0; t < result.taps; ++t) {
+            const std::size_t pixel = first + t;
+            const double lo = begin > double(pixel) ? begin : double(pixel);
+            const double hi = end < double(pixel + 1) ? end : double(pixel + 1);
+            result.index[t * count + i] = static_cast<int>(pixel < source ? pixel : source - 1);
+            result.weights[t * count + i] = (pixel < source && hi > lo) ? float((hi - lo) / scale) : 0.0f;
+        }
+    }
+    return result;
+}
+
+// vertical taps into one float row (whole source width), then horizontal taps gathered from it
+template <typename S, typename T>
+void resize_separable(const image_plane<S>& src, const image_plane<T>& dst, const resize_taps& columns, const resize_taps& rows) {
+    using V = vec512<float>;
+    float_row source_row(round_up_lanes(src.width));
+    float_row mixed(round_up_lanes(src.width));
+
+    for (std::size_t y = 0; y < dst.height; ++y) {
+        std::fill(mixed.begin(), mixed.end(), 0.0f);
+        for (std::size_t t = 0; t < rows.taps; ++t) {
+            const float weight = rows.weights[t * dst.height + y];
+            if (weight == 0.0f) { continue; }
+            row_to_float(src.row(static_cast<std::size_t>(rows.index[t * dst.height + y])), source_row.data(), src.width);
+            const auto w = V::set1(weight);
+            for (std::size_t x = 0; x < src.width; x += V::lanes) {
+                V::storeu(mixed.data() + x, V::fmadd(w, V::loadu(source_row.data() + x), V::loadu(mixed.data() + x)));
+            }
+        }
+
+        T* out = dst.row(y);
+        for (std::size_t x = 0; x < dst.width; x += V::lanes) {
+            const auto m = V::up_to(dst.width - x);
+            auto sum = V::zero();
+            for (std::size_t t = 0; t < columns.taps; ++t) {
+                const __m512i index = _mm512_maskz_loadu_epi32(m, columns.index.data() + t * dst.width + x);
+                const auto weight = V::loadu(columns.weights.data() + t * dst.width + x, m);
+                sum = V::fmadd(weight, _mm512_i32gather_ps(index, mixed.data(), 4), sum);
+            }
+            store_pixels(out + x, sum, m);
+        }
+    }
+}
+
+} // namespace intrin_detail
+
+/////////////////////// PLANE FUNCTIONS - filters
+
+// dst = src convolved with kernel_x (2 * radius_x + 1 taps) along rows, then kernel_y along columns
+template <typename S, typename T>
+void separable_convolve(const image_plane<S>& src, const image_plane<T>& dst, const float* kernel_x, const std::size_t radius_x,
+                        const float* kernel_y, const std::size_t radius_y) {
+    static_assert(std::is_same_v<std::remove_const_t<S>, T>, "source and destination planes hold the same pixel type");
+    using V = vec512<float>;
+    const std::size_t width = src.width;
+    const std::size_t height = src.height;
+    const std::size_t row_stride = intrin_detail::round_up_lanes(width);
+    const std::size_t halo = 2 * radius_y;
+    const std::size_t rows = intrin_detail::strip_rows(width, halo);
+
+    intrin_detail::float_row padded(intrin_detail::round_up_lanes(width + 2 * radius_x));
+    intrin_detail::float_row strip((rows + halo) * row_stride);
+    std::vector<const float*> taps(2 * radius_y + 1);
+
+    for (std::size_t y0 = 0; y0 < height; y0 += rows) {
+        const std::size_t y1 = y0 + rows < height ? y0 + rows : height;
+        // horizontal pass over the strip plus its halo rows (edge rows repeated)
+        for (std::size_t r = 0; r < y1 - y0 + halo; ++r) {
+            const std::size_t source = intrin_detail::clamp_row(static_cast<long long>(y0 + r) - static_cast<long long>(radius_y), height);
+            intrin_detail::pad_row(src.row(source), width, radius_x, padded.data());
+            intrin_detail::convolve_row(padded.data(), width, kernel_x, 2 * radius_x + 1, strip.data() + r * row_stride);
+        }
+        // vertical pass from the cached rows
+        for (std::size_t y = y0; y < y1; ++y) {
+            for (std::size_t j = 0; j < taps.size(); ++j) { taps[j] = strip.data() + (y - y0 + j) * row_stride; }
+            T* out = dst.row(y);
+            for (std::size_t x = 0; x < width; x += V::lanes) {
+                const auto m = V::up_to(width - x);
+                auto sum = V::zero();
+                for (std::size_t j = 0; j < taps.size(); ++j) { sum = V::fmadd(V::set1(kernel_y[j]), V::loadu(taps[j] + x), sum); }
+                intrin_detail::store_pixels(out + x, sum, m);
+            }
+        }
+    }
+}
+
+// normalized gaussian, radius ceil(3 sigma) unless given
+template <typename S, typename T>
+void gaussian_blur(const image_plane<S>& src, const image_plane<T>& dst, const float sigma, std::size_t radius = 0) {
+    if (radius == 0) { radius = static_cast<std::size_t>(std::ceil(3.0f * sigma)); }
+    if (radius == 0) { radius = 1; }
+    std::vector<float> kernel(2 * radius + 1);
+    double total = 0.0;
+    for (std::size_t j = 0; j < kernel.size(); ++j) {
+        const double d = double(j) - double(radius);
+        total += kernel[j] = float(std::exp(-d * d / (2.0 * double(sigma) * double(sigma))));
+    }
+    for (float& weight : kernel) { weight = float(weight / total); }
+    separable_convolve(src, dst, kernel.data(), radius, kernel.data(), radius);
+}
+
+// mean over the (2 * radius + 1)^2 square. Rows are summed horizontally (doubling, see box_row), and
+// the vertical sum is a running sum: each output row adds one row and subtracts the one that left,
+// from a ring of 2 * radius + 1 row sums. uint8 planes sum in int32 and are exact.
+template <typename S, typename T>
+void box_blur(const image_plane<S>& src, const image_plane<T>& dst, const std::size_t radius) {
+    static_assert(std::is_same_v<std::remove_const_t<S>, T>, "source and destination planes hold the same pixel type");
+    using A = std::conditional_t<std::is_same_v<T, std::uint8_t>, int, float>;
+    using VA = vec512<A>;
+    const std::size_t width = src.width;
+    const std::size_t height = src.height;
+    const std::size_t window = 2 * radius + 1;
+    const std::size_t row_stride = intrin_detail::round_up_lanes(width);
+    const auto scale = vec512<float>::set1(1.0f / float(window * window));
+
+    std::vector<A, aligned_allocator<A>> padded(intrin_detail::round_up_lanes(width + 2 * radius));
+    std::vector<A, aligned_allocator<A>> ring(window * row_stride);
+    std::vector<A, aligned_allocator<A>> sum(row_stride, A(0));
+
+    // ring slot of row t (t >= -radius) is (t + radius) % window: row y - radius and row y + radius + 1 share it
+    const auto horizontal = [&](const long long t, A* out) {
+        intrin_detail::box_pad_row(src.row(intrin_detail::clamp_row(t, height)), width, radius, padded.data());
+        intrin_detail::box_row(padded.data(), width, window, out);
+    };
+    for (std::size_t slot = 0; slot < window; ++slot) {
+        A* row = ring.data() + slot * row_stride;
+        horizontal(static_cast<long long>(slot) - static_cast<long long>(radius), row);
+        for (std::size_t x = 0; x < width; x += VA::lanes) {
+            const auto m = VA::up_to(width - x);
+            VA::storeu(sum.data() + x, VA::add(VA::loadu(sum.data() + x, m), VA::loadu(row + x, m)), m);
+        }
+    }
+
+    for (std::size_t y = 0; y < height; ++y) {
+        T* out = dst.row(y);
+        for (std::size_t x = 0; x < width; x += VA::lanes) {
+            const auto m = VA::up_to(width - x);
+            intrin_detail::store_pixels(out + x, vec512<float>::mul(intrin_detail::to_float(VA::loadu(sum.data() + x, m)), scale), m);
+        }
+        if (y + 1 == height) { break; }
+
+        A* row = ring.data() + (y % window) * row_stride;
+        for (std::size_t x = 0; x < width; x += VA::lanes) {
+            const auto m = VA::up_to(width - x);
+            VA::storeu(sum.data() + x, VA::sub(VA::loadu(sum.data() + x, m), VA::loadu(row + x, m)), m);
+        }
+        horizontal(static_cast<long long>(y + radius + 1), row);
+        for (std::size_t x = 0; x < width; x += VA::lanes) {
+            const auto m = VA::up_to(width - x);
+            VA::storeu(sum.data() + x, VA::add(VA::loadu(sum.data() + x, m), VA::loadu(row + x, m)), m);
+        }
+    }
+}
+
+/////////////////////// PLANE FUNCTIONS - resize (dst.width / dst.height give the new size)
+
+template <typename S, typename T>
+void resize_bilinear(const image_plane<S>& src, const image_plane<T>& dst) {
+    static_assert(std::is_same_v<std::remove_const_t<S>, T>, "source and destination planes hold the same pixel type");
+    intrin_detail::resize_separable(src, dst, intrin_detail::bilinear_taps(src.width, dst.width),
+                                    intrin_detail::bilinear_taps(src.height, dst.height));
+}
+
+// box-filter (pixel area) resampling, the anti-aliased choice for shrinking
+template <typename S, typename T>
+void resize_area(const image_plane<S>& src, const image_plane<T>& dst) {
+    static_assert(std::is_same_v<std::remove_const_t<S>, T>, "source and destination planes hold the same pixel type");
+    intrin_detail::resize_separable(src, dst, intrin_detail::area_taps(src.width, dst.width),
+                                    intrin_detail::area_taps(src.height, dst.height));
+}
+
+#endif //INTRIN__INTRIN_IMAGE_H
@@ -0,0 +1,354 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Polynomials, lookup tables and splines over float and double registers, vector types and buffers.
+// usage: const float c[4] = {c0, c1, c2, c3};   evaluate_polynomial(in, out, count, c);   // c0 + c1 x + c2 x^2 + c3 x^3
+//        const lut_interpolator<float> lut(table, 32, lo, hi);   lut.apply(in, out, count);
+//        const cubic_spline<double> spline(xs, ys, knots);   double_8_array_a32 y {}; y = spline(x);
+//
+// The degree is the length of the coefficient array (compile time). Tables of up to 2 registers
+// (16 / 32 floats, 8 / 16 doubles) are looked up in registers with permutexvar / permutex2var, larger
+// ones with gathers. Inputs outside a table / the knots are clamped to its ends.
+
+#ifndef INTRIN__INTRIN_INTERP_H
+#define INTRIN__INTRIN_INTERP_H
+
+#include "intrin_generic.h"
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace intrin_detail {
+
+// int32 lane indices, in a __m512i for both (the low half for double)
+inline __m512i floor_index(const __m512 t) { return _mm512_cvttps_epi32(t); }
+inline __m512i floor_index(const __m512d t) { return _mm512_castsi256_si512(_mm512_cvttpd_epi32(t)); }
+
+template <typename T>
+typename vec512<T>::reg index_to_real(const __m512i index) {
+    if constexpr (sizeof(T) == 4) {
+        return _mm512_cvtepi32_ps(index);
+    } else {
+        return _mm512_cvtepi32_pd(_mm512_castsi512_si256(index));
+    }
+}
+
+inline __m512 table_permute(const __m512i index, const __m512 table) { return _mm512_permutexvar_ps(index, table); }
+inline __m512d table_permute(const __m512i index, const __m512d table) {
+    return _mm512_permutexvar_pd(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(index)), table);
+}
+inline __m512 table_permute(const __m512i index, const __m512 low, const __m512 high) {
+    return _mm512_permutex2var_ps(low, index, high);
+}
+inline __m512d table_permute(const __m512i index, const __m512d low, const __m512d high) {
+    return _mm512_permutex2var_pd(low, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(index)), high);
+}
+inline __m512 table_gather(const __m512i index, const float* base) { return _mm512_i32gather_ps(index, base, 4); }
+inline __m512d table_gather(const __m512i index, const double* base) {
+    return _mm512_i32gather_pd(_mm512_castsi512_si256(index), base, 8);
+}
+
+// a table indexed per lane: kept in one or two registers when it fits, gathered from memory otherwise
+template <typename T>
+struct lane_table {
+    using V = vec512<T>;
+    std::vector<T, aligned_allocator<T>> entries;
+    typename V::reg low;
+    typename V::reg high;
+
+    lane_table() = default;
+    lane_table(const T* values, const std::size_t count) : entries(values, values + count) {
+        T padded[2 * V::lanes] = {};
+        for (std::size_t i = 0; i < count && i < 2 * V::lanes; ++i) { padded[i] = values[i]; }
+        low = V::loadu(padded);
+        high = V::loadu(padded + V::lanes);
+    }
+
+    typename V::reg lookup(const __m512i index) const {
+        if (entries.size() <= V::lanes) { return table_permute(index, low); }
+        if (entries.size() <= 2 * V::lanes) { return table_permute(index, low, high); }
+        return table_gather(index, entries.data());
+    }
+};
+
+// index of the segment [knots[i], knots[i + 1]) holding x, for i in [0, count - 2]: compares against every
+// inner knot for short lists, branch-free binary search with gathers for long ones
+template <typename T>
+__m512i find_segment(const typename vec512<T>::reg x, const lane_table<T>& knots) {
+    using V = vec512<T>;
+    const int segments = static_cast<int>(knots.entries.size()) - 1;
+    __m512i index = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi32(1);
+
+    if (segments <= 16) {
+        for (int k = 1; k < segments; ++k) {
+            const auto above = V::cmp_le(V::set1(knots.entries[k]), x);
+            index = _mm512_mask_add_epi32(index, above, index, one);
+        }
+        return index;
+    }
+
+    int step = 1;
+    while (step * 2 < segments) { step *= 2; }
+    const __m512i last = _mm512_set1_epi32(segments - 1);
+    for (; step > 0; step /= 2) {
+        const __m512i probe = _mm512_add_epi32(index, _mm512_set1_epi32(step));
+        const auto valid = static_cast<typename V::mask>(_mm512_cmple_epi32_mask(probe, last));
+        const auto knot = table_gather(_mm512_min_epi32(probe, last), knots.entries.data());
+        const auto take = valid & V::cmp_le(knot, x);
+        index = _mm512_mask_mov_epi32(index, take, probe);
+    }
+    return index;
+}
+
+// x^1, x^2, x^4 ... as many as Estrin's scheme needs for Count coefficients
+constexpr std::size_t estrin_levels(const std::size_t count) {
+    std::size_t levels = 0;
+    while ((std::size_t(1) << levels) < count) { ++levels; }
+    return levels;
+}
+
+constexpr std::size_t lower_power_of_two(const std::size_t count) {
+    std::size_t power = 1;
+    while (power * 2 < count) { power *= 2; }
+    return power;
+}
+
+template <typename T, std::size_t Begin, std::size_t Count, std::size_t N>
+typename vec512<T>::reg estrin_range(const typename vec512<T>::reg* powers, const T (&coefficients)[N]) {
+    using V = vec512<T>;
+    if constexpr (Count == 1) {
+        return V::set1(coefficients[Begin]);
+    } else if constexpr (Count == 2) {
+        return V::fmadd(V::set1(coefficients[Begin + 1]), powers[0], V::set1(coefficients[Begin]));
+    } else {
+        constexpr std::size_t half = lower_power_of_two(Count);
+        const auto upper = estrin_range<T, Begin + half, Count - half>(powers, coefficients);
+        const auto lower = estrin_range<T, Begin, half>(powers, coefficients);
+        return V::fmadd(upper, powers[estrin_levels(half)], lower);
+    }
+}
+
+} // namespace intrin_detail
+
+/////////////////////// POLYNOMIALS - coefficients[k] multiplies x^k
+
+// Horner: N - 1 dependent fused multiply-adds, fewest operations
+template <typename T, std::size_t N>
+typename vec512<T>::reg horner(const typename vec512<T>::reg x, const T (&coefficients)[N]) {
+    using V = vec512<T>;
+    auto result = V::set1(coefficients[N - 1]);
+    for (std::size_t k = N - 1; k-- > 0;) { result = V::fmadd(result, x, V::set1(coefficients[k])); }
+    return result;
+}
+
+// Estrin: pairs combined with x^2, x^4 ... in a tree, dependency chain of log2(N) for higher degrees
+template <typename T, std::size_t N>
+typename vec512<T>::reg estrin(const typename vec512<T>::reg x, const T (&coefficients)[N]) {
+    using V = vec512<T>;
+    constexpr std::size_t levels = intrin_detail::estrin_levels(N);
+    typename V::reg powers[levels + 1];
+    powers[0] = x;
+    for (std::size_t k = 1; k < levels; ++k) { powers[k] = V::mul(powers[k - 1], powers[k - 1]); }
+    return intrin_detail::estrin_range<T, 0, N>(powers, coefficients);
+}
+
+/////////////////////// BUFFER FUNCTIONS - polynomials
+
+template <typename T, std::size_t N>
+void evaluate_polynomial(const T* in, T* out, const std::size_t length, const T (&coefficients)[N]) {
+    using V = vec512<T>;
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const auto m = V::up_to(length - i);
+        const auto x = V::loadu(in + i, m);
+        V::storeu(out + i, N > 4 ? estrin(x, coefficients) : horner(x, coefficients), m);
+    }
+}
+
+// Interleaved channels (frame after frame of channels samples), channel c evaluated with coefficients[c].
+// The per-lane coefficient pattern repeats every channels / gcd(channels, lanes) registers; those
+// registers' worth of coefficients are laid out once, so the loop is Horner with coefficient loads.
+template <typename T, std::size_t N>
+void evaluate_channel_polynomials(const T* in, T* out, const std::size_t frames, const std::size_t channels,
+                                  const T (*coefficients)[N]) {
+    using V = vec512<T>;
+    const std::size_t length = frames * channels;
+    const std::size_t period = channels / std::gcd(channels, std::size_t(V::lanes));
+    std::vector<T, aligned_allocator<T>> pattern(period * N * V::lanes);
+    for (std::size_t set = 0; set < period; ++set) {
+        for (std::size_t k = 0; k < N; ++k) {
+            for (std::size_t lane = 0; lane < V::lanes; ++lane) {
+                pattern[(set * N + k) * V::lanes + lane] = coefficients[(set * V::lanes + lane) % channels][k];
+            }
+        }
+    }
+
+    std::size_t set = 0;
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const auto m = V::up_to(length - i);
+        const auto x = V::loadu(in + i, m);
+        const T* c = pattern.data() + set * N * V::lanes;
+        auto result = V::load(c + (N - 1) * V::lanes);
+        for (std::size_t k = N - 1; k-- > 0;) { result = V::fmadd(result, x, V::load(c + k * V::lanes)); }
+        V::storeu(out + i, result, m);
+        set = set + 1 == period ? 0 : set + 1;
+    }
+}
+
+/////////////////////// LOOKUP TABLE - uniformly spaced samples, linear interpolation
+
+template <typename T>
+struct lut_interpolator {
+    using V = vec512<T>;
+    intrin_detail::lane_table<T> values;
+    intrin_detail::lane_table<T> slopes; // values[i + 1] - values[i]
+    T lo;
+    T scale;    // entries per unit of x
+    T last;     // count - 1
+
+    // table[i] is the value at lo + i * (hi - lo) / (count - 1); count >= 2
+    lut_interpolator(const T* table, const std::size_t count, const T lo, const T hi)
+        : values(table, count), lo(lo), scale(T(count - 1) / (hi - lo)), last(T(count - 1)) {
+        std::vector<T> differences(count);
+        for (std::size_t i = 0; i + 1 < count; ++i) { differences[i] = table[i + 1] - table[i]; }
+        slopes = intrin_detail::lane_table<T>(differences.data(), count);
+    }
+
+    typename V::reg operator()(const typename V::reg x) const {
+        auto t = V::mul(V::sub(x, V::set1(lo)), V::set1(scale));
+        t = V::min(V::max(t, V::zero()), V::set1(last)); // NaN goes to 0
+        const __m512i index = _mm512_min_epi32(intrin_detail::floor_index(t), _mm512_set1_epi32(static_cast<int>(last) - 1));
+        const auto fraction = V::sub(t, intrin_detail::index_to_real<T>(index));
+        return V::fmadd(fraction, slopes.lookup(index), values.lookup(index));
+    }
+
+    void apply(const T* in, T* out, const std::size_t length) const {
+        for (std::size_t i = 0; i < length; i += V::lanes) {
+            const auto m = V::up_to(length - i);
+            V::storeu(out + i, (*this)(V::loadu(in + i, m)), m);
+        }
+    }
+
+    template <typename Vec>
+    auto apply(const Vec& in, Vec& out) const -> decltype(apply(in.data, out.data, std::size(in.data))) {
+        apply(in.data, out.data, std::size(in.data));
+    }
+};
+
+/////////////////////// PIECEWISE LINEAR - ascending knots, any spacing
+
+template <typename T>
+struct piecewise_linear {
+    using V = vec512<T>;
+    intrin_detail::lane_table<T> knots;
+    intrin_detail::lane_table<T> values;
+    intrin_detail::lane_table<T> slopes;
+
+    // (xs[i], ys[i]) for i < count, xs ascending, count >= 2
+    piecewise_linear(const T* xs, const T* ys, const std::size_t count) : knots(xs, count), values(ys, count) {
+        std::vector<T> gradient(count);
+        for (std::size_t i = 0; i + 1 < count; ++i) { gradient[i] = (ys[i + 1] - ys[i]) / (xs[i + 1] - xs[i]); }
+        slopes = intrin_detail::lane_table<T>(gradient.data(), count);
+    }
+
+    typename V::reg operator()(typename V::reg x) const {
+        x = V::min(V::max(x, V::set1(knots.entries.front())), V::set1(knots.entries.back()));
+        const __m512i index = intrin_detail::find_segment(x, knots);
+        return V::fmadd(V::sub(x, knots.lookup(index)), slopes.lookup(index), values.lookup(index));
+    }
+
+    void apply(const T* in, T* out, const std::size_t length) const {
+        for (std::size_t i = 0; i < length; i += V::lanes) {
+            const auto m = V::up_to(length - i);
+            V::storeu(out + i, (*this)(V::loadu(in + i, m)), m);
+        }
+    }
+
+    template <typename Vec>
+    auto apply(const Vec& in, Vec& out) const -> decltype(apply(in.data, out.data, std::size(in.data))) {
+        apply(in.data, out.data, std::size(in.data));
+    }
+};
+
+/////////////////////// CUBIC SPLINE - natural (zero curvature at both ends), ascending knots
+
+template <typename T>
+struct cubic_spline {
+    using V = vec512<T>;
+    intrin_detail::lane_table<T> knots;
+    intrin_detail::lane_table<T> c0, c1, c2, c3; // per segment: y = c0 + c1 d + c2 d^2 + c3 d^3, d = x - knot
+
+    // (xs[i], ys[i]) for i < count, xs ascending, count >= 2; the curvatures are solved once, in double
+    cubic_spline(const T* xs, const T* ys, const std::size_t count) : knots(xs, count) {
+        std::vector<double> curvature(count, 0.0), diagonal(count, 1.0), rhs(count, 0.0), h(count, 0.0);
+        for (std::size_t i = 0; i + 1 < count; ++i) { h[i] = double(xs[i + 1]) - double(xs[i]); }
+        // tridiagonal system for the inner knots (Thomas algorithm), curvature 0 at both ends
+        for (std::size_t i = 1; i + 1 < count; ++i) {
+            diagonal[i] = 2.0 * (h[i - 1] + h[i]);
+            rhs[i] = 6.0 * ((double(ys[i + 1]) - ys[i]) / h[i] - (double(ys[i]) - ys[i - 1]) / h[i - 1]);
+            if (i > 1) {
+                const double factor = h[i - 1] / diagonal[i - 1];
+                diagonal[i] -= factor * h[i - 1];
+                rhs[i] -= factor * rhs[i - 1];
+            }
+        }
+        for (std::size_t i = count - 1; i-- > 1;) {
+            curvature[i] = (rhs[i] - h[i] * curvature[i + 1]) / diagonal[i];
+        }
+
+        std::vector<T> a(count), b(count), c(count), d(count);
+        for (std::size_t i = 0; i + 1 < count; ++i) {
+            a[i] = ys[i];
+            b[i] = T((double(ys[i + 1]) - ys[i]) / h[i] - h[i] * (2.0 * curvature[i] + curvature[i + 1]) / 6.0);
+            c[i] = T(curvature[i] / 2.0);
+            d[i] = T((curvature[i + 1] - curvature[i]) / (6.0 * h[i]));
+        }
+        c0 = intrin_detail::lane_table<T>(a.data(), count);
+        c1 = intrin_detail::lane_table<T>(b.data(), count);
+        c2 = intrin_detail::lane_table<T>(c.data(), count);
+        c3 = intrin_detail::lane_table<T>(d.data(), count);
+    }
+
+    typename V::reg operator()(typename V::reg x) const {
+        x = V::min(V::max(x, V::set1(knots.entries.front())), V::set1(knots.entries.back()));
+        const __m512i index = intrin_detail::find_segment(x, knots);
+        const auto offset = V::sub(x, knots.lookup(index));
+        auto result = V::fmadd(c3.lookup(index), offset, c2.lookup(index));
+        result = V::fmadd(result, offset, c1.lookup(index));
+        return V::fmadd(result, offset, c0.lookup(index));
+    }
+
+    void apply(const T* in, T* out, const std::size_t length) const {
+        for (std::size_t i = 0; i < length; i += V::lanes) {
+            const auto m = V::up_to(length - i);
+            V::storeu(out + i, (*this)(V::loadu(in + i, m)), m);
+        }
+    }
+
+    template <typename Vec>
+    auto apply(const Vec& in, Vec& out) const -> decltype(apply(in.data, out.data, std::size(in.data))) {
+        apply(in.data, out.data, std::size(in.data));
+    }
+};
+
+#endif //INTRIN__INTRIN_INTERP_H
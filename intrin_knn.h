@@ -0,0 +1,325 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Batched distances (queries x database) and exact brute-force k-nearest-neighbour search, float or int8 databases.
+// usage: const knn_database<float> db(vectors, count, dim);      // knn_database<std::int8_t> quantizes the rows
+//        knn_search(queries, query_count, db, k, distance_metric::l2, indices, distances);
+//
+// Distances are "smaller is nearer": l2 is the squared euclidean distance (|q|^2 + |d|^2 - 2 q.d, clamped at 0),
+// inner_product is -q.d and cosine is 1 - q.d / (|q| |d|). All come from dot products computed 4 queries x 4
+// database rows at a time (16 FMA accumulators). The database is walked in tiles of tuning().tile_bytes and
+// every query runs over a tile before the next one is loaded, so a batch reads the database once from memory.
+// int8 databases keep one symmetric scale per row and are widened to float in registers, a quarter of the
+// memory traffic of float rows. Each query keeps its k best in a max-heap; a register of 16 distances is
+// compared against the current k-th best first, so only candidates that can enter reach the heap.
+
+#ifndef INTRIN__INTRIN_KNN_H
+#define INTRIN__INTRIN_KNN_H
+
+#include "intrin_generic.h"
+#include "intrin_tune.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+enum class distance_metric { l2, inner_product, cosine };
+
+// float: refers to the caller's rows (count x dim, row-major), which must outlive it.
+// std::int8_t: owns rows quantized with a per-row scale (max |x| / 127), or copies already quantized ones.
+template <typename T>
+struct knn_database {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, std::int8_t>, "float or int8 databases");
+
+    const T* rows = nullptr;
+    std::size_t count = 0;
+    std::size_t dim = 0;
+    std::vector<float> scales; // int8 only: row value = scale * stored value
+    std::vector<float> norms;  // squared L2 norm of every (dequantized) row
+    std::vector<T, aligned_allocator<T>> storage;
+
+    knn_database(const float* vectors, const std::size_t count_, const std::size_t dim_) : count(count_), dim(dim_), norms(count_) {
+        if constexpr (std::is_same_v<T, float>) {
+            rows = vectors;
+        } else {
+            storage.resize(count * dim);
+            scales.resize(count);
+            for (std::size_t r = 0; r < count; ++r) {
+                const float* row = vectors + r * dim;
+                float largest = 0.0f;
+                for (std::size_t i = 0; i < dim; ++i) { largest = std::max(largest, std::fabs(row[i])); }
+                scales[r] = largest > 0.0f ? largest / 127.0f : 1.0f;
+                for (std::size_t i = 0; i < dim; ++i) { storage[r * dim + i] = static_cast<std::int8_t>(std::lrint(row[i] / scales[r])); }
+            }
+            rows = storage.data();
+        }
+        compute_norms();
+    }
+
+    knn_database(const std::int8_t* quantized, const float* row_scales, const std::size_t count_, const std::size_t dim_)
+        : count(count_), dim(dim_), scales(row_scales, row_scales + count_), norms(count_), storage(quantized, quantized + count_ * dim_) {
+        static_assert(std::is_same_v<T, std::int8_t>, "pre-quantized rows make an int8 database");
+        rows = storage.data();
+        compute_norms();
+    }
+
+    float scale(const std::size_t r) const {
+        if constexpr (std::is_same_v<T, float>) {
+            return 1.0f;
+        } else {
+            return scales[r];
+        }
+    }
+
+private:
+    void compute_norms() {
+        for (std::size_t r = 0; r < count; ++r) {
+            float sum = 0.0f;
+            for (std::size_t i = 0; i < dim; ++i) { sum += float(rows[r * dim + i]) * float(rows[r * dim + i]); }
+            norms[r] = sum * scale(r) * scale(r);
+        }
+    }
+};
+
+namespace intrin_detail {
+
+inline __m512 load_row(const float* p) { return _mm512_loadu_ps(p); }
+inline __m512 load_row(const std::int8_t* p) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+}
+
+// the last count (< 16) elements, zero filled
+template <typename T>
+__m512 load_row_tail(const T* p, const std::size_t count) {
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm512_maskz_loadu_ps(vec512<float>::up_to(count), p);
+    } else {
+        T part[16] = {};
+        std::memcpy(part, p, count);
+        return load_row(part);
+    }
+}
+
+// permutex2var indices of round r of the transposed reduction: registers hold 16 >> r items of 16 >> r
+// partial sums each; the low (high) half of every item's partial sums of both registers, items in order
+struct reduce_indices {
+    alignas(64) int lanes[4][2][16];
+
+    constexpr reduce_indices() : lanes() {
+        for (int round = 0; round < 4; ++round) {
+            const int partials = 16 >> round, half = partials / 2, items = 16 / partials;
+            for (int high = 0; high < 2; ++high) {
+                for (int lane = 0; lane < 16; ++lane) {
+                    const int item = lane / half, part = lane % half + high * half;
+                    lanes[round][high][lane] = item < items ? item * partials + part : 16 + (item - items) * partials + part;
+                }
+            }
+        }
+    }
+};
+
+inline constexpr reduce_indices transposed_reduction {};
+
+// dots[r][c] = q_r . d_c for 4 queries and 4 database rows
+template <typename T>
+void dot_tile_4x4(const float* const* queries, const T* const* rows, const std::size_t dim, float (*dots)[4]) {
+    using V = vec512<float>;
+    V::reg acc[4][4];
+#pragma GCC unroll 4
+    for (int r = 0; r < 4; ++r) {
+#pragma GCC unroll 4
+        for (int c = 0; c < 4; ++c) { acc[r][c] = V::zero(); }
+    }
+    const auto step = [&](const V::reg (&q)[4], const V::reg (&d)[4]) {
+#pragma GCC unroll 4
+        for (int r = 0; r < 4; ++r) {
+#pragma GCC unroll 4
+            for (int c = 0; c < 4; ++c) { acc[r][c] = V::fmadd(q[r], d[c], acc[r][c]); }
+        }
+    };
+    std::size_t i = 0;
+    for (; i + V::lanes <= dim; i += V::lanes) {
+        V::reg q[4], d[4];
+#pragma GCC unroll 4
+        for (int k = 0; k < 4; ++k) { q[k] = V::loadu(queries[k] + i), d[k] = load_row(rows[k] + i); }
+        step(q, d);
+    }
+    if (i < dim) {
+        V::reg q[4], d[4];
+        for (int k = 0; k < 4; ++k) { q[k] = V::loadu(queries[k] + i, V::up_to(dim - i)), d[k] = load_row_tail(rows[k] + i, dim - i); }
+        step(q, d);
+    }
+    // transposed reduction: four rounds halve the partial sums per accumulator while doubling the
+    // accumulators per register, ending with lane 4 r + c = q_r . d_c
+    V::reg level[16];
+    for (int j = 0; j < 16; ++j) { level[j] = acc[j / 4][j % 4]; }
+#pragma GCC unroll 4
+    for (int round = 0; round < 4; ++round) {
+        const __m512i low = _mm512_load_si512(transposed_reduction.lanes[round][0]);
+        const __m512i high = _mm512_load_si512(transposed_reduction.lanes[round][1]);
+#pragma GCC unroll 8
+        for (int j = 0; j < (8 >> round); ++j) {
+            level[j] = V::add(_mm512_permutex2var_ps(level[2 * j], low, level[2 * j + 1]),
+                              _mm512_permutex2var_ps(level[2 * j], high, level[2 * j + 1]));
+        }
+    }
+    _mm512_storeu_ps(&dots[0][0], level[0]);
+}
+
+inline float distance_from_dot(const distance_metric metric, const float dot, const float query_norm, const float row_norm) {
+    switch (metric) {
+        case distance_metric::l2: return std::max(0.0f, query_norm + row_norm - 2.0f * dot);
+        case distance_metric::inner_product: return -dot;
+        default: {
+            const float norms = std::sqrt(query_norm * row_norm);
+            return norms > 0.0f ? 1.0f - dot / norms : 1.0f;
+        }
+    }
+}
+
+// visit(query, first_row, distances, row_count) for every query and database tile; tiles outermost
+template <typename T, typename Visitor>
+void for_each_distance_tile(const float* queries, const std::size_t query_count, const knn_database<T>& db,
+                            const distance_metric metric, Visitor&& visit) {
+    if (query_count == 0 || db.count == 0) { return; }
+    const std::size_t dim = db.dim;
+    std::vector<float> query_norms(query_count);
+    for (std::size_t q = 0; q < query_count; ++q) {
+        using V = vec512<float>;
+        auto sum = V::zero();
+        for (std::size_t i = 0; i < dim; i += V::lanes) {
+            const auto v = V::loadu(queries + q * dim + i, V::up_to(dim - i));
+            sum = V::fmadd(v, v, sum);
+        }
+        query_norms[q] = V::reduce_add(sum);
+    }
+
+    std::size_t tile_rows = tuning().tile_bytes / (dim * sizeof(T) + 1);
+    tile_rows = std::max<std::size_t>(4, tile_rows / 4 * 4);
+    std::vector<float> distances(4 * tile_rows);
+    float dots[4][4];
+
+    for (std::size_t tile = 0; tile < db.count; tile += tile_rows) {
+        const std::size_t rows_in_tile = std::min(tile_rows, db.count - tile);
+        for (std::size_t q0 = 0; q0 < query_count; q0 += 4) {
+            const float* query_rows[4];
+            for (std::size_t r = 0; r < 4; ++r) { query_rows[r] = queries + std::min(q0 + r, query_count - 1) * dim; }
+            for (std::size_t d0 = 0; d0 < rows_in_tile; d0 += 4) {
+                const T* database_rows[4];
+                for (std::size_t c = 0; c < 4; ++c) { database_rows[c] = db.rows + (tile + std::min(d0 + c, rows_in_tile - 1)) * dim; }
+                dot_tile_4x4(query_rows, database_rows, dim, dots);
+                for (std::size_t r = 0; r < 4 && q0 + r < query_count; ++r) {
+                    for (std::size_t c = 0; c < 4 && d0 + c < rows_in_tile; ++c) {
+                        const std::size_t row = tile + d0 + c;
+                        distances[r * tile_rows + d0 + c] = distance_from_dot(metric, dots[r][c] * db.scale(row), query_norms[q0 + r], db.norms[row]);
+                    }
+                }
+            }
+            for (std::size_t r = 0; r < 4 && q0 + r < query_count; ++r) { visit(q0 + r, tile, distances.data() + r * tile_rows, rows_in_tile); }
+        }
+    }
+}
+
+// the k smallest distances seen so far, largest on top
+class top_k_heap {
+public:
+    explicit top_k_heap(const std::size_t k) : k_(k) { items_.reserve(k); }
+
+    void offer(const float* distances, const std::size_t first_index, const std::size_t count) {
+        using V = vec512<float>;
+        if (k_ == 0) { return; }
+        for (std::size_t i = 0; i < count; i += V::lanes) {
+            const auto m = V::up_to(count - i);
+            unsigned bits = V::cmp_lt(V::loadu(distances + i, m), V::set1(threshold_)) & m;
+            while (bits) {
+                const unsigned lane = static_cast<unsigned>(__builtin_ctz(bits));
+                bits &= bits - 1;
+                push(distances[i + lane], first_index + i + lane);
+            }
+        }
+    }
+
+    // nearest first; slots beyond the number of candidates get index -1 and +inf
+    void write(std::size_t* indices, float* distances) {
+        std::sort_heap(items_.begin(), items_.end());
+        for (std::size_t i = 0; i < k_; ++i) {
+            const bool filled = i < items_.size();
+            if (indices) { indices[i] = filled ? items_[i].second : static_cast<std::size_t>(-1); }
+            if (distances) { distances[i] = filled ? items_[i].first : std::numeric_limits<float>::infinity(); }
+        }
+    }
+
+private:
+    void push(const float distance, const std::size_t index) {
+        if (items_.size() < k_) {
+            items_.emplace_back(distance, index);
+            std::push_heap(items_.begin(), items_.end());
+            if (items_.size() == k_) { threshold_ = items_.front().first; }
+            return;
+        }
+        if (!(distance < threshold_)) { return; } // the register was compared against an older threshold
+        std::pop_heap(items_.begin(), items_.end());
+        items_.back() = {distance, index};
+        std::push_heap(items_.begin(), items_.end());
+        threshold_ = items_.front().first;
+    }
+
+    std::size_t k_;
+    float threshold_ = std::numeric_limits<float>::infinity();
+    std::vector<std::pair<float, std::size_t>> items_;
+};
+
+} // namespace intrin_detail
+
+/////////////////////// BUFFER FUNCTIONS - distances and k-nearest neighbours
+
+// out[q * db.count + r] = distance from query q (queries: query_count x db.dim, row-major) to database row r
+template <typename T>
+void batch_distances(const float* queries, const std::size_t query_count, const knn_database<T>& db, const distance_metric metric, float* out) {
+    intrin_detail::for_each_distance_tile(queries, query_count, db, metric,
+        [&](const std::size_t q, const std::size_t first, const float* distances, const std::size_t count) {
+            std::memcpy(out + q * db.count + first, distances, count * sizeof(float));
+        });
+}
+
+// the k nearest rows of every query, nearest first: indices / distances are query_count x k (either may be null);
+// with fewer than k rows the remaining slots hold index -1 and distance +inf
+template <typename T>
+void knn_search(const float* queries, const std::size_t query_count, const knn_database<T>& db, const std::size_t k,
+                const distance_metric metric, std::size_t* indices, float* distances) {
+    std::vector<intrin_detail::top_k_heap> heaps(query_count, intrin_detail::top_k_heap(k));
+    intrin_detail::for_each_distance_tile(queries, query_count, db, metric,
+        [&](const std::size_t q, const std::size_t first, const float* tile_distances, const std::size_t count) {
+            heaps[q].offer(tile_distances, first, count);
+        });
+    for (std::size_t q = 0; q < query_count; ++q) {
+        heaps[q].write(indices ? indices + q * k : nullptr, distances ? distances + q * k : nullptr);
+    }
+}
+
+#endif //INTRIN__INTRIN_KNN_H
@@ -0,0 +1,179 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Numeric text parsing: CSV / whitespace separated float, double, int and long long samples into buffers.
+// usage: const parse_result r = parse_numbers(text, text_length, buffer, capacity, ',');
+//        std::vector<float, aligned_allocator<float>> samples; load_numbers("export.csv", samples, ',', 1);
+//
+// Separators are the delimiter and every byte up to ' ' (space, tab, CR, LF); runs of them count as one,
+// so empty fields are skipped. A structural pass classifies 64 bytes at a time with AVX2 byte compares
+// into bit masks and walks the field starts with count-trailing-zeros; each field is then converted by
+// std::from_chars (no locale, correctly rounded). A leading '+' is accepted.
+
+#ifndef INTRIN__INTRIN_PARSE_H
+#define INTRIN__INTRIN_PARSE_H
+
+#include "intrin_generic.h"
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+struct parse_result {
+    std::size_t count = 0;  // values written
+    std::size_t rows = 0;   // lines holding at least one value
+    std::size_t error_offset = static_cast<std::size_t>(-1); // first field that is not a number of the type, or did not fit
+
+    bool ok() const { return error_offset == static_cast<std::size_t>(-1); }
+};
+
+namespace intrin_detail {
+
+inline bool is_separator(const char c, const char delimiter) {
+    return static_cast<unsigned char>(c) <= 0x20 || c == delimiter;
+}
+
+// bit i: byte i is a separator (<= ' ' or the delimiter)
+inline std::uint32_t separator_bits(const __m256i bytes, const __m256i delimiter) {
+    const __m256i space = _mm256_set1_epi8(0x20);
+    const __m256i blank = _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, space), space);
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(blank, _mm256_cmpeq_epi8(bytes, delimiter))));
+}
+
+inline std::uint32_t newline_bits(const __m256i bytes) {
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n'))));
+}
+
+// calls visit(offset, first_in_row) for every field start, in order, until visit returns false
+template <typename Visitor>
+void for_each_field(const char* text, const std::size_t length, const char delimiter, Visitor&& visit) {
+    const __m256i delimiter_bytes = _mm256_set1_epi8(delimiter);
+    std::uint64_t previous_separator = 1; // the byte before the text counts as a separator
+    bool row_open = false;
+    alignas(32) char padded[64];
+
+    for (std::size_t base = 0; base < length; base += 64) {
+        const char* block = text + base;
+        if (length - base < 64) {
+            std::memset(padded, ' ', sizeof(padded));
+            std::memcpy(padded, block, length - base);
+            block = padded;
+        }
+        const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+        const std::uint64_t separators = separator_bits(low, delimiter_bytes) |
+                                         (std::uint64_t(separator_bits(high, delimiter_bytes)) << 32);
+        const std::uint64_t newlines = newline_bits(low) | (std::uint64_t(newline_bits(high)) << 32);
+
+        const std::uint64_t starts = ~separators & ((separators << 1) | previous_separator);
+        previous_separator = separators >> 63;
+
+        std::uint64_t events = starts | newlines;
+        while (events) {
+            const int bit = __builtin_ctzll(events);
+            events &= events - 1;
+            if ((newlines >> bit) & 1) {
+                row_open = false;
+                continue;
+            }
+            if (!visit(base + bit, !row_open)) { return; }
+            row_open = true;
+        }
+    }
+}
+
+} // namespace intrin_detail
+
+/////////////////////// BUFFER FUNCTIONS - parsing
+
+// number of fields in the text: the capacity parse_numbers needs
+inline std::size_t count_fields(const char* text, const std::size_t length, const char delimiter = ',') {
+    std::size_t count = 0;
+    intrin_detail::for_each_field(text, length, delimiter, [&count](std::size_t, bool) {
+        ++count;
+        return true;
+    });
+    return count;
+}
+
+// parses up to capacity values of type T (float, double, int, long long ...) into out;
+// stops at the first field that is not a number of T (or is out of its range) and reports its offset
+template <typename T>
+parse_result parse_numbers(const char* text, const std::size_t length, T* out, const std::size_t capacity,
+                           const char delimiter = ',') {
+    parse_result result;
+    const char* end = text + length;
+    intrin_detail::for_each_field(text, length, delimiter, [&](const std::size_t offset, const bool first_in_row) {
+        if (result.count == capacity) {
+            result.error_offset = offset;
+            return false;
+        }
+        const char* first = text + offset;
+        if (*first == '+' && first + 1 < end && first[1] != '-') { ++first; }
+
+        const auto converted = std::from_chars(first, end, out[result.count]);
+        if (converted.ec != std::errc() || (converted.ptr != end && !intrin_detail::is_separator(*converted.ptr, delimiter))) {
+            result.error_offset = offset;
+            return false;
+        }
+        ++result.count;
+        result.rows += first_in_row;
+        return true;
+    });
+    return result;
+}
+
+// reads the whole file with one read, drops the first skip_lines lines (headers) and parses the rest into
+// out, resized to the number of fields; offsets in the result are relative to the first parsed line
+template <typename T, typename Allocator>
+parse_result load_numbers(const char* path, std::vector<T, Allocator>& out, const char delimiter = ',',
+                          const std::size_t skip_lines = 0) {
+    parse_result result;
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        result.error_offset = 0;
+        return result;
+    }
+    std::string text(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    file.read(text.data(), static_cast<std::streamsize>(text.size()));
+
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    for (std::size_t line = 0; line < skip_lines && begin < end; ++line) {
+        const void* newline = std::memchr(begin, '\n', static_cast<std::size_t>(end - begin));
+        begin = newline ? static_cast<const char*>(newline) + 1 : end;
+    }
+
+    const std::size_t length = static_cast<std::size_t>(end - begin);
+    out.resize(count_fields(begin, length, delimiter));
+    result = parse_numbers(begin, length, out.data(), out.size(), delimiter);
+    out.resize(result.count);
+    return result;
+}
+
+#endif //INTRIN__INTRIN_PARSE_H
@@ -0,0 +1,370 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Lazy pipelines: chain element-wise and reduction stages, run them over a buffer in one pass.
+// usage: const auto pipe = pipeline<float>() | scale_by(2.0f) | add_offset(1.0f) | clamp_to(0.0f, 10.0f) | reduce_sum();
+//        const auto [total] = pipe.run(input, output, count);   // output may be input, or left out: pipe.run(input, count)
+//
+// Building a pipeline only stores the stages. run() loads one register, sends it through every stage and
+// stores it, so intermediates never leave the registers and the buffer is streamed once however many
+// stages there are. Reduction stages look at the value passing by (and hand it on unchanged); their
+// results come back from run() as a std::tuple, in stage order. The loop is unrolled over 4 registers
+// with separate reduction accumulators, merged at the end, so the reductions do not serialize the loop.
+// Outputs of at least tuning().streaming_threshold bytes are written with non-temporal stores (after a
+// masked head up to the first 64 byte boundary), so a large result does not evict the working set.
+
+#ifndef INTRIN__INTRIN_PIPELINE_H
+#define INTRIN__INTRIN_PIPELINE_H
+
+#include "intrin_generic.h"
+#include "intrin_tune.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace intrin_detail {
+
+struct no_state {};
+
+// non-temporal store of a whole register, ptr 64 byte aligned
+inline void stream_store(float* ptr, const __m512 value) { _mm512_stream_ps(ptr, value); }
+inline void stream_store(double* ptr, const __m512d value) { _mm512_stream_pd(ptr, value); }
+inline void stream_store(int* ptr, const __m512i value) { _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), value); }
+inline void stream_store(long long int* ptr, const __m512i value) { _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr), value); }
+
+// register accumulator of a reduction stage (wrapped: vector types lose their attributes as template arguments)
+template <typename T>
+struct accumulator {
+    typename vec512<T>::reg value;
+};
+
+template <typename T>
+constexpr T highest() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+}
+
+template <typename T>
+constexpr T lowest() {
+    return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest();
+}
+
+} // namespace intrin_detail
+
+/////////////////////// STAGES - element-wise
+// apply<T>(value, index, m): value holds elements index .. index + lanes - 1, m marks the valid ones
+
+template <typename U>
+struct scale_stage {
+    static constexpr bool is_reduction = false;
+    U factor;
+
+    template <typename T>
+    typename vec512<T>::reg apply(const typename vec512<T>::reg x, std::size_t, typename vec512<T>::mask) const {
+        return vec512<T>::mul(x, vec512<T>::set1(static_cast<T>(factor)));
+    }
+};
+
+template <typename U>
+struct offset_stage {
+    static constexpr bool is_reduction = false;
+    U offset;
+
+    template <typename T>
+    typename vec512<T>::reg apply(const typename vec512<T>::reg x, std::size_t, typename vec512<T>::mask) const {
+        return vec512<T>::add(x, vec512<T>::set1(static_cast<T>(offset)));
+    }
+};
+
+// x * factor + offset in one fused multiply-add (float and double)
+template <typename U>
+struct multiply_add_stage {
+    static constexpr bool is_reduction = false;
+    U factor;
+    U offset;
+
+    template <typename T>
+    typename vec512<T>::reg apply(const typename vec512<T>::reg x, std::size_t, typename vec512<T>::mask) const {
+        return vec512<T>::fmadd(x, vec512<T>::set1(static_cast<T>(factor)), vec512<T>::set1(static_cast<T>(offset)));
+    }
+};
+
+template <typename U>
+struct clamp_stage {
+    static constexpr bool is_reduction = false;
+    U lo;
+    U hi;
+
+    template <typename T>
+    typename vec512<T>::reg apply(const typename vec512<T>::reg x, std::size_t, typename vec512<T>::mask) const {
+        using V = vec512<T>;
+        return V::min(V::max(x, V::set1(static_cast<T>(lo))), V::set1(static_cast<T>(hi)));
+    }
+};
+
+// element-wise with a second buffer of the same length: x + other[i] / x * other[i]
+template <typename U>
+struct add_buffer_stage {
+    static constexpr bool is_reduction = false;
+    const U* other;
+
+    template <typename T>
+    typename vec512<T>::reg apply(const typename vec512<T>::reg x, const std::size_t index, const typename vec512<T>::mask m) const {
+        return vec512<T>::add(x, vec512<T>::loadu(other + index, m));
+    }
+};
+
+template <typename U>
+struct multiply_buffer_stage {
+    static constexpr bool is_reduction = false;
+    const U* other;
+
+    template <typename T>
+    typename vec512<T>::reg apply(const typename vec512<T>::reg x, const std::size_t index, const typename vec512<T>::mask m) const {
+        return vec512<T>::mul(x, vec512<T>::loadu(other + index, m));
+    }
+};
+
+// any register function, e.g. map_register([](__m512 x) { return _mm512_sqrt_ps(x); })
+template <typename F>
+struct map_stage {
+    static constexpr bool is_reduction = false;
+    F function;
+
+    template <typename T>
+    typename vec512<T>::reg apply(const typename vec512<T>::reg x, std::size_t, typename vec512<T>::mask) const {
+        return function(x);
+    }
+};
+
+template <typename U>
+scale_stage<U> scale_by(const U factor) { return {factor}; }
+
+template <typename U>
+offset_stage<U> add_offset(const U offset) { return {offset}; }
+
+template <typename U>
+multiply_add_stage<U> multiply_add(const U factor, const U offset) { return {factor, offset}; }
+
+template <typename U>
+clamp_stage<U> clamp_to(const U lo, const U hi) { return {lo, hi}; }
+
+template <typename U>
+add_buffer_stage<U> add_buffer(const U* other) { return {other}; }
+
+template <typename U>
+multiply_buffer_stage<U> multiply_buffer(const U* other) { return {other}; }
+
+template <typename F>
+map_stage<F> map_register(F function) { return {function}; }
+
+/////////////////////// STAGES - reductions
+// state<T> holds the register accumulator; accumulate only takes the lanes in m
+
+struct sum_stage {
+    static constexpr bool is_reduction = true;
+    template <typename T>
+    using state = intrin_detail::accumulator<T>;
+
+    template <typename T>
+    state<T> init() const { return {vec512<T>::zero()}; }
+    template <typename T>
+    state<T> accumulate(const state<T> acc, const typename vec512<T>::reg x, const typename vec512<T>::mask m) const {
+        return {vec512<T>::blend(m, acc.value, vec512<T>::add(acc.value, x))};
+    }
+    template <typename T>
+    state<T> merge(const state<T> a, const state<T> b) const { return {vec512<T>::add(a.value, b.value)}; }
+    template <typename T>
+    T finish(const state<T> acc) const { return vec512<T>::reduce_add(acc.value); }
+};
+
+struct min_stage {
+    static constexpr bool is_reduction = true;
+    template <typename T>
+    using state = intrin_detail::accumulator<T>;
+
+    template <typename T>
+    state<T> init() const { return {vec512<T>::set1(intrin_detail::highest<T>())}; }
+    template <typename T>
+    state<T> accumulate(const state<T> acc, const typename vec512<T>::reg x, const typename vec512<T>::mask m) const {
+        return {vec512<T>::blend(m, acc.value, vec512<T>::min(acc.value, x))};
+    }
+    template <typename T>
+    state<T> merge(const state<T> a, const state<T> b) const { return {vec512<T>::min(a.value, b.value)}; }
+    template <typename T>
+    T finish(const state<T> acc) const { return vec512<T>::reduce_min(acc.value); }
+};
+
+struct max_stage {
+    static constexpr bool is_reduction = true;
+    template <typename T>
+    using state = intrin_detail::accumulator<T>;
+
+    template <typename T>
+    state<T> init() const { return {vec512<T>::set1(intrin_detail::lowest<T>())}; }
+    template <typename T>
+    state<T> accumulate(const state<T> acc, const typename vec512<T>::reg x, const typename vec512<T>::mask m) const {
+        return {vec512<T>::blend(m, acc.value, vec512<T>::max(acc.value, x))};
+    }
+    template <typename T>
+    state<T> merge(const state<T> a, const state<T> b) const { return {vec512<T>::max(a.value, b.value)}; }
+    template <typename T>
+    T finish(const state<T> acc) const { return vec512<T>::reduce_max(acc.value); }
+};
+
+inline sum_stage reduce_sum() { return {}; }
+inline min_stage reduce_min() { return {}; }
+inline max_stage reduce_max() { return {}; }
+
+namespace intrin_detail {
+
+template <typename T, typename Stage, bool = Stage::is_reduction>
+struct stage_state { using type = no_state; };
+
+template <typename T, typename Stage>
+struct stage_state<T, Stage, true> { using type = typename Stage::template state<T>; };
+
+} // namespace intrin_detail
+
+/////////////////////// PIPELINE
+
+// T: element type of the buffers (int, long long, float, double)
+template <typename T, typename... Stages>
+struct pipeline {
+    using V = vec512<T>;
+    using states = std::tuple<typename intrin_detail::stage_state<T, Stages>::type...>;
+
+    std::tuple<Stages...> stages;
+
+    // appends a stage; the pipeline itself is left as it was
+    template <typename Stage>
+    pipeline<T, Stages..., Stage> operator|(const Stage& stage) const {
+        return {std::tuple_cat(stages, std::make_tuple(stage))};
+    }
+
+    // output[i] = stages(input[i]) for all i, one pass; returns the reduction results
+    auto run(const T* input, T* output, const std::size_t length) const { return execute<true>(input, output, length); }
+
+    // reductions only, nothing stored
+    auto run(const T* input, const std::size_t length) const { return execute<false>(input, nullptr, length); }
+
+private:
+    template <std::size_t I = 0>
+    typename V::reg step(typename V::reg x, const std::size_t index, const typename V::mask m, states& acc) const {
+        if constexpr (I == sizeof...(Stages)) {
+            return x;
+        } else {
+            const auto& stage = std::get<I>(stages);
+            using Stage = std::tuple_element_t<I, std::tuple<Stages...>>;
+            if constexpr (Stage::is_reduction) {
+                std::get<I>(acc) = stage.template accumulate<T>(std::get<I>(acc), x, m);
+            } else {
+                x = stage.template apply<T>(x, index, m);
+            }
+            return step<I + 1>(x, index, m, acc);
+        }
+    }
+
+    template <std::size_t... I>
+    states initial_states(std::index_sequence<I...>) const {
+        return states {init_state<I>()...};
+    }
+
+    template <std::size_t I>
+    std::tuple_element_t<I, states> init_state() const {
+        if constexpr (std::tuple_element_t<I, std::tuple<Stages...>>::is_reduction) {
+            return std::get<I>(stages).template init<T>();
+        } else {
+            return {};
+        }
+    }
+
+    template <std::size_t I>
+    void merge_state(states& into, const states& from) const {
+        if constexpr (std::tuple_element_t<I, std::tuple<Stages...>>::is_reduction) {
+            std::get<I>(into) = std::get<I>(stages).template merge<T>(std::get<I>(into), std::get<I>(from));
+        }
+    }
+
+    template <std::size_t I>
+    auto finish_state(const states& acc) const {
+        if constexpr (std::tuple_element_t<I, std::tuple<Stages...>>::is_reduction) {
+            return std::make_tuple(std::get<I>(stages).template finish<T>(std::get<I>(acc)));
+        } else {
+            return std::tuple<> {};
+        }
+    }
+
+    template <std::size_t... I>
+    auto finish_all(states acc[4], std::index_sequence<I...>) const {
+        (merge_state<I>(acc[0], acc[1]), ...);
+        (merge_state<I>(acc[2], acc[3]), ...);
+        (merge_state<I>(acc[0], acc[2]), ...);
+        return std::tuple_cat(finish_state<I>(acc[0])...);
+    }
+
+    template <bool Store>
+    auto execute(const T* input, T* output, const std::size_t length) const {
+        constexpr std::size_t lanes = V::lanes;
+        const auto all = V::up_to(lanes);
+        const auto sequence = std::index_sequence_for<Stages...> {};
+        states acc[4] = {initial_states(sequence), initial_states(sequence), initial_states(sequence), initial_states(sequence)};
+
+        std::size_t i = 0;
+        const auto address = reinterpret_cast<std::uintptr_t>(output);
+        const bool stream = Store && address % sizeof(T) == 0 && length * sizeof(T) >= tuning().streaming_threshold;
+        if (stream) {
+            // masked head up to the first 64 byte boundary, so the streaming stores are aligned
+            const std::size_t head = (64 - address % 64) % 64 / sizeof(T);
+            i = head < length ? head : length;
+            if (i != 0) {
+                const auto m = V::up_to(i);
+                V::storeu(output, step(V::loadu(input, m), 0, m, acc[0]), m);
+            }
+        }
+        for (; i + 4 * lanes <= length; i += 4 * lanes) {
+#pragma GCC unroll 4
+            for (std::size_t u = 0; u < 4; ++u) {
+                const std::size_t index = i + u * lanes;
+                const auto value = step(V::loadu(input + index), index, all, acc[u]);
+                if constexpr (Store) {
+                    if (stream) {
+                        intrin_detail::stream_store(output + index, value);
+                    } else {
+                        V::storeu(output + index, value);
+                    }
+                }
+            }
+        }
+        for (; i < length; i += lanes) {
+            const auto m = V::up_to(length - i);
+            const auto value = step(V::loadu(input + i, m), i, m, acc[0]);
+            if constexpr (Store) { V::storeu(output + i, value, m); }
+        }
+        if (stream) { _mm_sfence(); }
+        return finish_all(acc, sequence);
+    }
+};
+
+#endif //INTRIN__INTRIN_PIPELINE_H
@@ -23,12 +23,100 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SO
 
 // print_vector function, which can be used with any structure that has an array variable
 // usage: std::cout << delim(vector_to_print, delim);     // delim is of const char* type (c-style strings)
+//
+// bulk writers for buffers and vector types: shortest round-trip text through std::to_chars into one
+// pre-sized buffer and a single write (ignores the stream's formatting flags), or the raw bytes
+// usage: write_text(std::cout, buffer, count, ", ");   write_binary(file_stream, buffer, count);
 
 #ifndef INTRIN__INTRIN_PRINT_H
 #define INTRIN__INTRIN_PRINT_H
 #include <iostream>
 #include <iterator>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace intrin_detail {
+
+template <typename T>
+constexpr bool chars_convertible = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+// longest std::to_chars output of one value: sign, digits, point and exponent ("-2.2250738585072014e-308")
+template <typename T>
+constexpr std::size_t max_chars() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::numeric_limits<T>::max_digits10 + 8;
+    } else {
+        return std::numeric_limits<T>::digits10 + 2;
+    }
+}
+
+} // namespace intrin_detail
+
+/////////////////////// BUFFER FUNCTIONS - bulk text and binary output
+
+// bytes format_text can write for length values
+template <typename T>
+std::size_t text_capacity(const std::size_t length, const char* delimiter) {
+    static_assert(intrin_detail::chars_convertible<T>, "text output needs an integer or floating point element type");
+    return length * intrin_detail::max_chars<T>() + (length ? length - 1 : 0) * std::strlen(delimiter);
+}
+
+// writes the values separated by delimiter into buffer (at least text_capacity bytes, no terminator);
+// returns the number of characters written
+template <typename T>
+std::size_t format_text(const T* data, const std::size_t length, const char* delimiter, char* buffer) {
+    static_assert(intrin_detail::chars_convertible<T>, "text output needs an integer or floating point element type");
+    const std::size_t delimiter_length = std::strlen(delimiter);
+    char* position = buffer;
+    for (std::size_t i = 0; i < length; ++i) {
+        if (i) {
+            std::memcpy(position, delimiter, delimiter_length);
+            position += delimiter_length;
+        }
+        position = std::to_chars(position, position + intrin_detail::max_chars<T>(), data[i]).ptr;
+    }
+    return static_cast<std::size_t>(position - buffer);
+}
+
+template <typename T>
+void write_text(std::ostream& out_stream, const T* data, const std::size_t length, const char* delimiter = ", ") {
+    std::string text(text_capacity<T>(length, delimiter), '\0');
+    const std::size_t size = format_text(data, length, delimiter, text.data());
+    out_stream.write(text.data(), static_cast<std::streamsize>(size));
+}
+
+template <typename T>
+auto write_text(std::ostream& out_stream, const T& type_object, const char* delimiter = ", ")
+    -> decltype(write_text(out_stream, type_object.data, std::size(type_object.data), delimiter)) {
+    write_text(out_stream, type_object.data, std::size(type_object.data), delimiter);
+}
+
+// raw bytes in memory order (native endianness)
+template <typename T>
+void write_binary(std::ostream& out_stream, const T* data, const std::size_t length) {
+    static_assert(std::is_trivially_copyable_v<T>, "binary output needs a trivially copyable element type");
+    out_stream.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(length * sizeof(T)));
+}
+
+template <typename T>
+auto write_binary(std::ostream& out_stream, const T& type_object)
+    -> decltype(write_binary(out_stream, type_object.data, std::size(type_object.data))) {
+    write_binary(out_stream, type_object.data, std::size(type_object.data));
+}
+
+// reads back what write_binary wrote; returns the number of whole values read
+template <typename T>
+std::size_t read_binary(std::istream& in_stream, T* data, const std::size_t length) {
+    static_assert(std::is_trivially_copyable_v<T>, "binary input needs a trivially copyable element type");
+    in_stream.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(length * sizeof(T)));
+    return static_cast<std::size_t>(in_stream.gcount()) / sizeof(T);
+}
 
+// stream output: honours the stream's formatting (precision, fixed / scientific, hex, width of each element)
 template <typename T>
 void print_vector(std::ostream& out_stream, const T& type_object, const char* delim) {
     out_stream << "| "; //start of the print
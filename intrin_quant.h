@@ -0,0 +1,296 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Quantized dot products and GEMM: uint8 x int8 and int16 x int16 with int32 accumulation,
+// plus per-channel requantization back to float or int8.
+// usage: quantized_gemm(activations, weights, acc, rows, cols, depth);
+//        requantize(acc, rows, cols, scales, offsets, out);
+//
+// Layouts are row-major: activations rows x depth, weights cols x depth (one row per output channel,
+// as a linear layer stores them), acc rows x cols.
+//
+// The kernel is picked once at run time: AVX512 VNNI (vpdpbusd / vpdpwssd) when the CPU has it,
+// AVX512BW (vpmaddubsw + vpmaddwd) next, AVX2 otherwise. VNNI and the int16 paths are exact.
+// Without VNNI the uint8 x int8 pairs go through the saturating int16 sum of maddubs, so
+// a[2i] * b[2i] + a[2i + 1] * b[2i + 1] has to fit in int16 -- true for activations up to 127
+// or weights within [-64, 64]; quantize with 7 bit activations when the results must match VNNI.
+
+#ifndef INTRIN__INTRIN_QUANT_H
+#define INTRIN__INTRIN_QUANT_H
+
+#include "intrin_generic.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace intrin_detail {
+
+enum class quant_isa { avx2, avx512bw, avx512vnni };
+
+inline quant_isa detect_quant_isa() {
+    static const quant_isa isa = __builtin_cpu_supports("avx512bw")
+        ? (__builtin_cpu_supports("avx512vnni") ? quant_isa::avx512vnni : quant_isa::avx512bw)
+        : quant_isa::avx2;
+    return isa;
+}
+
+template <typename A, typename B>
+std::int32_t scalar_dot(const A* a, const B* b, const std::size_t length) {
+    std::int32_t sum = 0;
+    for (std::size_t i = 0; i < length; ++i) { sum += std::int32_t(a[i]) * std::int32_t(b[i]); }
+    return sum;
+}
+
+inline std::int32_t reduce_add_epi32(const __m256i v) {
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(sum);
+}
+
+// Tiles: c[r * ldc + k] = dot(a row r, b row k) for Rows x Cols rows, every a row loaded once per
+// step is reused against all Cols weight rows (and the other way round). The Rows / Cols loops are
+// unrolled so the accumulators stay in registers.
+
+template <int Rows, int Cols, typename A, typename B>
+void quant_tile_avx2(const A* a, const std::size_t lda, const B* b, const std::size_t ldb, const std::size_t depth,
+                     std::int32_t* c, const std::size_t ldc) {
+    constexpr std::size_t step = 32 / sizeof(A);
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i acc[Rows][Cols];
+    for (auto& row : acc) {
+        for (auto& v : row) { v = _mm256_setzero_si256(); }
+    }
+
+    std::size_t i = 0;
+    for (; i + step <= depth; i += step) {
+        __m256i vb[Cols];
+#pragma GCC unroll 4
+        for (int k = 0; k < Cols; ++k) { vb[k] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + k * ldb + i)); }
+#pragma GCC unroll 4
+        for (int r = 0; r < Rows; ++r) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + r * lda + i));
+#pragma GCC unroll 4
+            for (int k = 0; k < Cols; ++k) {
+                if constexpr (std::is_same_v<A, std::int16_t>) {
+                    acc[r][k] = _mm256_add_epi32(acc[r][k], _mm256_madd_epi16(va, vb[k]));
+                } else {
+                    acc[r][k] = _mm256_add_epi32(acc[r][k], _mm256_madd_epi16(_mm256_maddubs_epi16(va, vb[k]), ones));
+                }
+            }
+        }
+    }
+    for (int r = 0; r < Rows; ++r) {
+        for (int k = 0; k < Cols; ++k) {
+            c[r * ldc + k] = reduce_add_epi32(acc[r][k]) + scalar_dot(a + r * lda + i, b + k * ldb + i, depth - i);
+        }
+    }
+}
+
+// whole register while remaining >= 64 bytes, zero-filled masked load for the tail
+template <typename A>
+__attribute__((target("avx512bw"))) inline __m512i quant_load_512(const A* ptr, const std::size_t remaining) {
+    constexpr std::size_t step = 64 / sizeof(A);
+    if (remaining >= step) { return _mm512_loadu_si512(ptr); }
+    if constexpr (sizeof(A) == 1) {
+        return _mm512_maskz_loadu_epi8(_cvtu64_mask64((1ULL << remaining) - 1), ptr);
+    } else {
+        return _mm512_maskz_loadu_epi16(_cvtu32_mask32((1U << remaining) - 1), ptr);
+    }
+}
+
+template <int Rows, int Cols, typename A, typename B>
+__attribute__((target("avx512bw"))) void quant_tile_avx512bw(const A* a, const std::size_t lda, const B* b, const std::size_t ldb,
+                                                              const std::size_t depth, std::int32_t* c, const std::size_t ldc) {
+    constexpr std::size_t step = 64 / sizeof(A);
+    const __m512i ones = _mm512_set1_epi16(1);
+    __m512i acc[Rows][Cols];
+    for (auto& row : acc) {
+        for (auto& v : row) { v = _mm512_setzero_si512(); }
+    }
+
+    for (std::size_t i = 0; i < depth; i += step) {
+        __m512i vb[Cols];
+#pragma GCC unroll 4
+        for (int k = 0; k < Cols; ++k) { vb[k] = quant_load_512(b + k * ldb + i, depth - i); }
+#pragma GCC unroll 4
+        for (int r = 0; r < Rows; ++r) {
+            const __m512i va = quant_load_512(a + r * lda + i, depth - i);
+#pragma GCC unroll 4
+            for (int k = 0; k < Cols; ++k) {
+                if constexpr (std::is_same_v<A, std::int16_t>) {
+                    acc[r][k] = _mm512_add_epi32(acc[r][k], _mm512_madd_epi16(va, vb[k]));
+                } else {
+                    acc[r][k] = _mm512_add_epi32(acc[r][k], _mm512_madd_epi16(_mm512_maddubs_epi16(va, vb[k]), ones));
+                }
+            }
+        }
+    }
+    for (int r = 0; r < Rows; ++r) {
+        for (int k = 0; k < Cols; ++k) { c[r * ldc + k] = _mm512_reduce_add_epi32(acc[r][k]); }
+    }
+}
+
+template <int Rows, int Cols, typename A, typename B>
+__attribute__((target("avx512bw,avx512vnni"))) void quant_tile_avx512vnni(const A* a, const std::size_t lda, const B* b,
+                                                                           const std::size_t ldb, const std::size_t depth,
+                                                                           std::int32_t* c, const std::size_t ldc) {
+    constexpr std::size_t step = 64 / sizeof(A);
+    __m512i acc[Rows][Cols];
+    for (auto& row : acc) {
+        for (auto& v : row) { v = _mm512_setzero_si512(); }
+    }
+
+    for (std::size_t i = 0; i < depth; i += step) {
+        __m512i vb[Cols];
+#pragma GCC unroll 4
+        for (int k = 0; k < Cols; ++k) { vb[k] = quant_load_512(b + k * ldb + i, depth - i); }
+#pragma GCC unroll 4
+        for (int r = 0; r < Rows; ++r) {
+            const __m512i va = quant_load_512(a + r * lda + i, depth - i);
+#pragma GCC unroll 4
+            for (int k = 0; k < Cols; ++k) {
+                if constexpr (std::is_same_v<A, std::int16_t>) {
+                    acc[r][k] = _mm512_dpwssd_epi32(acc[r][k], va, vb[k]);
+                } else {
+                    acc[r][k] = _mm512_dpbusd_epi32(acc[r][k], va, vb[k]);
+                }
+            }
+        }
+    }
+    for (int r = 0; r < Rows; ++r) {
+        for (int k = 0; k < Cols; ++k) { c[r * ldc + k] = _mm512_reduce_add_epi32(acc[r][k]); }
+    }
+}
+
+template <int Rows, int Cols, typename A, typename B>
+void quant_tile(const quant_isa isa, const A* a, const std::size_t lda, const B* b, const std::size_t ldb,
+                const std::size_t depth, std::int32_t* c, const std::size_t ldc) {
+    switch (isa) {
+        case quant_isa::avx512vnni: quant_tile_avx512vnni<Rows, Cols>(a, lda, b, ldb, depth, c, ldc); break;
+        case quant_isa::avx512bw: quant_tile_avx512bw<Rows, Cols>(a, lda, b, ldb, depth, c, ldc); break;
+        default: quant_tile_avx2<Rows, Cols>(a, lda, b, ldb, depth, c, ldc); break;
+    }
+}
+
+// 2 activation rows x 4 weight rows per tile: 8 accumulators, 6 loads per step
+template <typename A, typename B>
+void quant_gemm(const quant_isa isa, const A* a, const B* b, std::int32_t* c,
+                const std::size_t rows, const std::size_t cols, const std::size_t depth) {
+    std::size_t r = 0;
+    for (; r + 2 <= rows; r += 2) {
+        std::size_t k = 0;
+        for (; k + 4 <= cols; k += 4) { quant_tile<2, 4>(isa, a + r * depth, depth, b + k * depth, depth, depth, c + r * cols + k, cols); }
+        for (; k < cols; ++k) { quant_tile<2, 1>(isa, a + r * depth, depth, b + k * depth, depth, depth, c + r * cols + k, cols); }
+    }
+    for (; r < rows; ++r) {
+        std::size_t k = 0;
+        for (; k + 4 <= cols; k += 4) { quant_tile<1, 4>(isa, a + r * depth, depth, b + k * depth, depth, depth, c + r * cols + k, cols); }
+        for (; k < cols; ++k) { quant_tile<1, 1>(isa, a + r * depth, depth, b + k * depth, depth, depth, c + r * cols + k, cols); }
+    }
+}
+
+} // namespace intrin_detail
+
+/////////////////////// BUFFER FUNCTIONS - dot products and GEMM
+
+inline std::int32_t quantized_dot(const std::uint8_t* a, const std::int8_t* b, const std::size_t length) {
+    std::int32_t result = 0;
+    intrin_detail::quant_tile<1, 1>(intrin_detail::detect_quant_isa(), a, 0, b, 0, length, &result, 1);
+    return result;
+}
+
+inline std::int32_t quantized_dot(const std::int16_t* a, const std::int16_t* b, const std::size_t length) {
+    std::int32_t result = 0;
+    intrin_detail::quant_tile<1, 1>(intrin_detail::detect_quant_isa(), a, 0, b, 0, length, &result, 1);
+    return result;
+}
+
+// acc[r][k] = sum_i activations[r][i] * weights[k][i]
+inline void quantized_gemm(const std::uint8_t* activations, const std::int8_t* weights, std::int32_t* acc,
+                           const std::size_t rows, const std::size_t cols, const std::size_t depth) {
+    intrin_detail::quant_gemm(intrin_detail::detect_quant_isa(), activations, weights, acc, rows, cols, depth);
+}
+
+inline void quantized_gemm(const std::int16_t* activations, const std::int16_t* weights, std::int32_t* acc,
+                           const std::size_t rows, const std::size_t cols, const std::size_t depth) {
+    intrin_detail::quant_gemm(intrin_detail::detect_quant_isa(), activations, weights, acc, rows, cols, depth);
+}
+
+/////////////////////// BUFFER FUNCTIONS - requantization
+
+// offsets[k] = zero_point * sum_i weights[k][i]: the term an activation zero point adds to output channel k
+inline void quantized_weight_offsets(const std::int8_t* weights, const std::size_t cols, const std::size_t depth,
+                                     const std::int32_t zero_point, std::int32_t* offsets) {
+    for (std::size_t k = 0; k < cols; ++k) {
+        const std::int8_t* row = weights + k * depth;
+        __m512i sums = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for (; i + 16 <= depth; i += 16) {
+            sums = _mm512_add_epi32(sums, _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i))));
+        }
+        std::int32_t sum = _mm512_reduce_add_epi32(sums);
+        for (; i < depth; ++i) { sum += row[i]; }
+        offsets[k] = zero_point * sum;
+    }
+}
+
+// out[r][k] = (acc[r][k] - offsets[k]) * scales[k] (+ bias[k]); offsets and bias may be null
+inline void requantize(const std::int32_t* acc, const std::size_t rows, const std::size_t cols, const float* scales,
+                       const std::int32_t* offsets, float* out, const float* bias = nullptr) {
+    using F = vec512<float>;
+    using I = vec512<int>;
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t k = 0; k < cols; k += F::lanes) {
+            const auto m = F::up_to(cols - k);
+            auto value = I::loadu(acc + r * cols + k, m);
+            if (offsets) { value = I::sub(value, I::loadu(offsets + k, m)); }
+            auto scaled = F::mul(_mm512_cvtepi32_ps(value), F::loadu(scales + k, m));
+            if (bias) { scaled = F::add(scaled, F::loadu(bias + k, m)); }
+            F::storeu(out + r * cols + k, scaled, m);
+        }
+    }
+}
+
+// out[r][k] = saturate_int8(round((acc[r][k] - offsets[k]) * scales[k]) + zero_point), ties to even;
+// scales[k] is the whole activation * weight / output scale of channel k
+inline void requantize(const std::int32_t* acc, const std::size_t rows, const std::size_t cols, const float* scales,
+                       const std::int32_t* offsets, const std::int32_t zero_point, std::int8_t* out) {
+    using F = vec512<float>;
+    using I = vec512<int>;
+    const auto shift = I::set1(zero_point);
+    // clamped in float first: cvtps_epi32 gives INT_MIN beyond the int32 range, and + zero_point could wrap
+    const auto low = F::set1(-128.0f - float(zero_point)), high = F::set1(127.0f - float(zero_point));
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t k = 0; k < cols; k += F::lanes) {
+            const auto m = F::up_to(cols - k);
+            auto value = I::loadu(acc + r * cols + k, m);
+            if (offsets) { value = I::sub(value, I::loadu(offsets + k, m)); }
+            const auto scaled = F::min(F::max(F::mul(_mm512_cvtepi32_ps(value), F::loadu(scales + k, m)), low), high);
+            const auto rounded = I::add(_mm512_cvtps_epi32(scaled), shift);
+            _mm512_mask_cvtsepi32_storeu_epi8(out + r * cols + k, m, rounded);
+        }
+    }
+}
+
+#endif //INTRIN__INTRIN_QUANT_H
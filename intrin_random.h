@@ -0,0 +1,298 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Pseudo-random numbers in SIMD lanes: xoshiro256** running 8 independent streams, one per 64 bit lane.
+// usage: xoshiro256ss_x8 rng(seed);  float_16_array_a32 u {}; u = rng.uniform_float();
+//        fill_normal(rng, buffer, count, mean, stddev);   // bulk, float or double
+//
+// Lane k starts 2^128 * k steps into the sequence of the seed (the xoshiro jump function), so the lanes
+// never overlap. Normals use Box-Muller with in-register log and sin/cos polynomials; both the cosine
+// and the sine half of each pair are used.
+
+#ifndef INTRIN__INTRIN_RANDOM_H
+#define INTRIN__INTRIN_RANDOM_H
+
+#include "intrin_generic.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace intrin_detail {
+
+inline std::uint64_t splitmix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+inline std::uint64_t rotl64(const std::uint64_t x, const int k) { return (x << k) | (x >> (64 - k)); }
+
+inline void xoshiro256_step(std::uint64_t* s) {
+    const std::uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+}
+
+// advances a scalar state by 2^128 steps
+inline void xoshiro256_jump(std::uint64_t* s) {
+    static const std::uint64_t jump[] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                                         0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+    std::uint64_t t[4] = {0, 0, 0, 0};
+    for (const std::uint64_t word : jump) {
+        for (int bit = 0; bit < 64; ++bit) {
+            if (word & (1ULL << bit)) {
+                for (int i = 0; i < 4; ++i) { t[i] ^= s[i]; }
+            }
+            xoshiro256_step(s);
+        }
+    }
+    for (int i = 0; i < 4; ++i) { s[i] = t[i]; }
+}
+
+// [0, 1) from the top bits: mantissa bits under the exponent of 1.0 give [1, 2), minus one
+inline __m512 bits_to_unit_float(const __m512i bits) {
+    const __m512i one_to_two = _mm512_or_si512(_mm512_srli_epi32(bits, 9), _mm512_set1_epi32(0x3F800000));
+    return _mm512_sub_ps(_mm512_castsi512_ps(one_to_two), _mm512_set1_ps(1.0f));
+}
+inline __m512d bits_to_unit_double(const __m512i bits) {
+    const __m512i one_to_two = _mm512_or_si512(_mm512_srli_epi64(bits, 12), _mm512_set1_epi64(0x3FF0000000000000LL));
+    return _mm512_sub_pd(_mm512_castsi512_pd(one_to_two), _mm512_set1_pd(1.0));
+}
+
+// (0, 1], never zero, for the logarithm of Box-Muller: all 32 (or 53) bits plus half a step
+inline __m512 bits_to_open_float(const __m512i bits) {
+    return _mm512_mul_ps(_mm512_add_ps(_mm512_cvtepu32_ps(bits), _mm512_set1_ps(0.5f)), _mm512_set1_ps(2.3283064365386963e-10f));
+}
+inline __m512d bits_to_open_double(const __m512i bits) {
+    return _mm512_sub_pd(_mm512_set1_pd(1.0), bits_to_unit_double(bits));
+}
+
+inline __m512 mantissa(const __m512 x) { return _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+inline __m512d mantissa(const __m512d x) { return _mm512_getmant_pd(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+inline __m512 exponent(const __m512 x) { return _mm512_getexp_ps(x); }
+inline __m512d exponent(const __m512d x) { return _mm512_getexp_pd(x); }
+inline __m512 round_nearest(const __m512 x) { return _mm512_roundscale_ps(x, _MM_FROUND_TO_NEAREST_INT); }
+inline __m512d round_nearest(const __m512d x) { return _mm512_roundscale_pd(x, _MM_FROUND_TO_NEAREST_INT); }
+inline __m512 square_root(const __m512 x) { return _mm512_sqrt_ps(x); }
+inline __m512d square_root(const __m512d x) { return _mm512_sqrt_pd(x); }
+
+// Natural log of positive finite values: x = m * 2^e with m folded into [sqrt(1/2), sqrt(2)),
+// ln(m) = 2 atanh(s), s = (m - 1) / (m + 1), |s| < 0.172; the odd series is cut where it
+// drops below the precision of T (5 terms for float, 12 for double).
+template <typename T>
+typename vec512<T>::reg log_positive(const typename vec512<T>::reg x) {
+    using V = vec512<T>;
+    auto m = mantissa(x);
+    auto e = exponent(x);
+    const auto fold = V::cmp_gt(m, V::set1(T(1.4142135623730951)));
+    m = V::blend(fold, m, V::mul(m, V::set1(T(0.5))));
+    e = V::blend(fold, e, V::add(e, V::set1(T(1))));
+
+    const auto s = V::div(V::sub(m, V::set1(T(1))), V::add(m, V::set1(T(1))));
+    const auto z = V::mul(s, s);
+    constexpr int terms = sizeof(T) == 4 ? 5 : 12;
+    auto series = V::set1(T(1) / T(2 * terms - 1));
+    for (int k = terms - 2; k >= 0; --k) {
+        series = V::fmadd(series, z, V::set1(T(1) / T(2 * k + 1)));
+    }
+    const auto log_m = V::mul(V::mul(V::set1(T(2)), s), series);
+    return V::fmadd(e, V::set1(T(0.69314718055994531)), log_m);
+}
+
+// cos(2 pi u) and sin(2 pi u): quarter turns q = round(4u) are taken out exactly, the rest
+// x in [-pi/4, pi/4] goes through the Taylor polynomials, then q swaps / negates the pair.
+template <typename T>
+void sincos_turns(const typename vec512<T>::reg u, typename vec512<T>::reg& cos_out, typename vec512<T>::reg& sin_out) {
+    using V = vec512<T>;
+    const auto t = V::mul(u, V::set1(T(4)));
+    const auto q = round_nearest(t);
+    const auto x = V::mul(V::sub(t, q), V::set1(T(1.5707963267948966)));
+    const auto z = V::mul(x, x);
+
+    constexpr int terms = sizeof(T) == 4 ? 5 : 9;
+    // sin: x * (1 - z/3! + z^2/5! ...), cos: 1 - z/2! + z^2/4! ...
+    T sin_coeff[terms], cos_coeff[terms];
+    T factorial = 1;
+    for (int k = 0; k < terms; ++k) {
+        cos_coeff[k] = (k % 2 ? -T(1) : T(1)) / factorial;
+        factorial *= T(2 * k + 1);
+        sin_coeff[k] = (k % 2 ? -T(1) : T(1)) / factorial;
+        factorial *= T(2 * k + 2);
+    }
+    auto sin_r = V::set1(sin_coeff[terms - 1]);
+    auto cos_r = V::set1(cos_coeff[terms - 1]);
+    for (int k = terms - 2; k >= 0; --k) {
+        sin_r = V::fmadd(sin_r, z, V::set1(sin_coeff[k]));
+        cos_r = V::fmadd(cos_r, z, V::set1(cos_coeff[k]));
+    }
+    sin_r = V::mul(sin_r, x);
+
+    const auto q1 = V::cmp_eq(q, V::set1(T(1)));
+    const auto q2 = V::cmp_eq(q, V::set1(T(2)));
+    const auto q3 = V::cmp_eq(q, V::set1(T(3)));
+    const auto swap = q1 | q3;
+    const auto cos_negative = q1 | q2;
+    const auto sin_negative = q2 | q3;
+
+    const auto c = V::blend(swap, cos_r, sin_r);
+    const auto s = V::blend(swap, sin_r, cos_r);
+    cos_out = V::blend(cos_negative, c, V::sub(V::zero(), c));
+    sin_out = V::blend(sin_negative, s, V::sub(V::zero(), s));
+}
+
+} // namespace intrin_detail
+
+// 8 parallel xoshiro256** generators, state kept in registers (s0..s3, one 64 bit lane per stream)
+struct alignas(64) xoshiro256ss_x8 {
+    __m512i s0, s1, s2, s3;
+    __m512 spare_float;   // sine half of the last Box-Muller pair
+    __m512d spare_double;
+    bool has_spare_float = false;
+    bool has_spare_double = false;
+
+    explicit xoshiro256ss_x8(unsigned long long seed) {
+        std::uint64_t state[4];
+        std::uint64_t mix = seed;
+        for (auto& word : state) { word = intrin_detail::splitmix64(mix); }
+
+        alignas(64) std::uint64_t lanes[4][8];
+        for (int lane = 0; lane < 8; ++lane) {
+            for (int i = 0; i < 4; ++i) { lanes[i][lane] = state[i]; }
+            intrin_detail::xoshiro256_jump(state);
+        }
+        s0 = _mm512_load_si512(lanes[0]);
+        s1 = _mm512_load_si512(lanes[1]);
+        s2 = _mm512_load_si512(lanes[2]);
+        s3 = _mm512_load_si512(lanes[3]);
+        spare_float = _mm512_setzero_ps();
+        spare_double = _mm512_setzero_pd();
+    }
+
+    // 8 x 64 random bits (or 16 x 32); the * 5 and * 9 are shift-adds, 64 bit mullo needs AVX512DQ
+    __m512i next() {
+        const __m512i times5 = _mm512_add_epi64(_mm512_slli_epi64(s1, 2), s1);
+        const __m512i rotated = _mm512_rol_epi64(times5, 7);
+        const __m512i result = _mm512_add_epi64(_mm512_slli_epi64(rotated, 3), rotated);
+
+        const __m512i t = _mm512_slli_epi64(s1, 17);
+        s2 = _mm512_xor_si512(s2, s0);
+        s3 = _mm512_xor_si512(s3, s1);
+        s1 = _mm512_xor_si512(s1, s2);
+        s0 = _mm512_xor_si512(s0, s3);
+        s2 = _mm512_xor_si512(s2, t);
+        s3 = _mm512_rol_epi64(s3, 45);
+        return result;
+    }
+
+    // 16 floats in [0, 1), 23 random bits each
+    __m512 uniform_float() { return intrin_detail::bits_to_unit_float(next()); }
+
+    // 8 doubles in [0, 1), 52 random bits each
+    __m512d uniform_double() { return intrin_detail::bits_to_unit_double(next()); }
+
+    // 16 standard normal floats
+    __m512 normal_float() {
+        if (has_spare_float) {
+            has_spare_float = false;
+            return spare_float;
+        }
+        using V = vec512<float>;
+        const __m512 radius = intrin_detail::square_root(
+            V::mul(V::set1(-2.0f), intrin_detail::log_positive<float>(intrin_detail::bits_to_open_float(next()))));
+        __m512 c, s;
+        intrin_detail::sincos_turns<float>(uniform_float(), c, s);
+        spare_float = V::mul(radius, s);
+        has_spare_float = true;
+        return V::mul(radius, c);
+    }
+
+    // 8 standard normal doubles
+    __m512d normal_double() {
+        if (has_spare_double) {
+            has_spare_double = false;
+            return spare_double;
+        }
+        using V = vec512<double>;
+        const __m512d radius = intrin_detail::square_root(
+            V::mul(V::set1(-2.0), intrin_detail::log_positive<double>(intrin_detail::bits_to_open_double(next()))));
+        __m512d c, s;
+        intrin_detail::sincos_turns<double>(uniform_double(), c, s);
+        spare_double = V::mul(radius, s);
+        has_spare_double = true;
+        return V::mul(radius, c);
+    }
+};
+
+/////////////////////// BUFFER FUNCTIONS - bulk fill
+
+// raw bits, count 64 bit words
+inline void fill_random_bits(xoshiro256ss_x8& rng, unsigned long long* out, const std::size_t count) {
+    using V = vec512<long long int>;
+    for (std::size_t i = 0; i < count; i += V::lanes) {
+        V::storeu(reinterpret_cast<long long int*>(out + i), rng.next(), V::up_to(count - i));
+    }
+}
+
+// uniform in [lo, hi)
+inline void fill_uniform(xoshiro256ss_x8& rng, float* out, const std::size_t count, const float lo = 0.0f, const float hi = 1.0f) {
+    using V = vec512<float>;
+    const auto scale = V::set1(hi - lo);
+    const auto offset = V::set1(lo);
+    for (std::size_t i = 0; i < count; i += V::lanes) {
+        V::storeu(out + i, V::fmadd(rng.uniform_float(), scale, offset), V::up_to(count - i));
+    }
+}
+
+inline void fill_uniform(xoshiro256ss_x8& rng, double* out, const std::size_t count, const double lo = 0.0, const double hi = 1.0) {
+    using V = vec512<double>;
+    const auto scale = V::set1(hi - lo);
+    const auto offset = V::set1(lo);
+    for (std::size_t i = 0; i < count; i += V::lanes) {
+        V::storeu(out + i, V::fmadd(rng.uniform_double(), scale, offset), V::up_to(count - i));
+    }
+}
+
+// normal with the given mean and standard deviation
+inline void fill_normal(xoshiro256ss_x8& rng, float* out, const std::size_t count, const float mean = 0.0f, const float stddev = 1.0f) {
+    using V = vec512<float>;
+    const auto scale = V::set1(stddev);
+    const auto offset = V::set1(mean);
+    for (std::size_t i = 0; i < count; i += V::lanes) {
+        V::storeu(out + i, V::fmadd(rng.normal_float(), scale, offset), V::up_to(count - i));
+    }
+}
+
+inline void fill_normal(xoshiro256ss_x8& rng, double* out, const std::size_t count, const double mean = 0.0, const double stddev = 1.0) {
+    using V = vec512<double>;
+    const auto scale = V::set1(stddev);
+    const auto offset = V::set1(mean);
+    for (std::size_t i = 0; i < count; i += V::lanes) {
+        V::storeu(out + i, V::fmadd(rng.normal_double(), scale, offset), V::up_to(count - i));
+    }
+}
+
+#endif //INTRIN__INTRIN_RANDOM_H
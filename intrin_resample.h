@@ -0,0 +1,279 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Streaming sample-rate conversion of float / double signals: rational polyphase windowed-sinc, and linear or
+// cubic fractional resampling for arbitrary (also non-rational or drifting) ratios.
+// usage: polyphase_resampler<float> to_audio(250, 44100);
+//        std::vector<float> out(to_audio.max_output(n));  out.resize(to_audio.process(chunk, n, out.data()));
+//        fractional_resampler<double> drift(1.0001, resample_kind::cubic);   drift.process(in, n, out);
+//
+// Both keep the tail of the previous chunk, so a stream fed in chunks of any size gives the same output as
+// one call over the whole signal. process() returns the samples written; max_output(n) bounds them.
+//
+// polyphase_resampler reduces input_rate : output_rate to L : M and designs one Kaiser-windowed sinc at L x the
+// input rate, cut off at cutoff x the lower Nyquist frequency and zero_crossings zero crossings long on either
+// side; it is stored as a bank of L phases with the taps reversed and padded to whole registers, each phase
+// normalized to unit DC gain. Every output is one phase dotted with the newest input samples (FMA over the
+// taps). Output n is input time n M / L, delayed by delay() input samples.
+//
+// fractional_resampler computes a register of outputs at once: positions in double, gathered neighbours,
+// linear or Catmull-Rom cubic weights. It does not band-limit: downsample with polyphase_resampler.
+
+#ifndef INTRIN__INTRIN_RESAMPLE_H
+#define INTRIN__INTRIN_RESAMPLE_H
+
+#include "intrin_generic.h"
+#include "intrin_interp.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+enum class resample_kind { linear, cubic };
+
+namespace intrin_detail {
+
+// modified Bessel function of the first kind, order 0 (Kaiser window)
+inline double bessel_i0(const double x) {
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; term > 1e-16 * sum; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+inline std::size_t round_up_to(const std::size_t count, const std::size_t multiple) { return (count + multiple - 1) / multiple * multiple; }
+
+// out = history (the last keep samples of the previous call) followed by in
+template <typename T>
+void join_history(std::vector<T, aligned_allocator<T>>& out, const std::vector<T, aligned_allocator<T>>& history, const T* in, const std::size_t n) {
+    out.resize(history.size() + n);
+    std::memcpy(out.data(), history.data(), history.size() * sizeof(T));
+    std::memcpy(out.data() + history.size(), in, n * sizeof(T));
+}
+
+template <typename T>
+void keep_history(std::vector<T, aligned_allocator<T>>& history, const std::vector<T, aligned_allocator<T>>& joined) {
+    std::memcpy(history.data(), joined.data() + joined.size() - history.size(), history.size() * sizeof(T));
+}
+
+// lane positions first + lane * step split into the integer offset (int32 lanes, low half for double)
+// and the fraction; first + lanes * step stays small, so the fractions keep their precision
+inline void lane_positions(const double first, const double step, __m512i& index, __m512& fraction) {
+    const __m512d iota = _mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512d low = _mm512_fmadd_pd(iota, _mm512_set1_pd(step), _mm512_set1_pd(first));
+    const __m512d high = _mm512_fmadd_pd(_mm512_add_pd(iota, _mm512_set1_pd(8.0)), _mm512_set1_pd(step), _mm512_set1_pd(first));
+    const __m512d low_floor = _mm512_roundscale_pd(low, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    const __m512d high_floor = _mm512_roundscale_pd(high, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    index = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(low_floor)), _mm512_cvttpd_epi32(high_floor), 1);
+    const __m256 low_fraction = _mm512_cvtpd_ps(_mm512_sub_pd(low, low_floor));
+    const __m256 high_fraction = _mm512_cvtpd_ps(_mm512_sub_pd(high, high_floor));
+    fraction = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(low_fraction)), _mm256_castps_pd(high_fraction), 1));
+}
+
+inline void lane_positions(const double first, const double step, __m512i& index, __m512d& fraction) {
+    const __m512d positions = _mm512_fmadd_pd(_mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_pd(step), _mm512_set1_pd(first));
+    const __m512d floor = _mm512_roundscale_pd(positions, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    index = _mm512_castsi256_si512(_mm512_cvttpd_epi32(floor));
+    fraction = _mm512_sub_pd(positions, floor);
+}
+
+} // namespace intrin_detail
+
+/////////////////////// RESAMPLERS - rational polyphase windowed-sinc
+
+template <typename T>
+class polyphase_resampler {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "float or double samples");
+    using V = vec512<T>;
+
+public:
+    polyphase_resampler(const std::size_t input_rate, const std::size_t output_rate, const double zero_crossings = 16.0,
+                        const double kaiser_beta = 8.0, const double cutoff = 0.9) {
+        const std::size_t divisor = std::gcd(input_rate, output_rate);
+        up_ = output_rate / divisor;
+        down_ = input_rate / divisor;
+
+        // cycles per sample at the upsampled rate, and the filter length from the zero crossings
+        const double corner = cutoff * 0.5 / double(up_ > down_ ? up_ : down_);
+        const std::size_t length = static_cast<std::size_t>(std::ceil(zero_crossings / corner)) | 1;
+        taps_ = intrin_detail::round_up_to((length + up_ - 1) / up_, V::lanes);
+        delay_ = (double(length) - 1.0) / 2.0 / double(up_);
+
+        bank_.assign(up_ * taps_, T(0));
+        const double pi = 3.14159265358979323846;
+        const double centre = (double(length) - 1.0) / 2.0;
+        const double window_scale = 1.0 / intrin_detail::bessel_i0(kaiser_beta);
+        std::vector<double> sums(up_, 0.0);
+        std::vector<double> filter(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            const double t = double(i) - centre;
+            const double x = 2.0 * corner * t;
+            const double sinc = x == 0.0 ? 1.0 : std::sin(pi * x) / (pi * x);
+            const double r = t / centre;
+            const double window = intrin_detail::bessel_i0(kaiser_beta * std::sqrt(std::max(0.0, 1.0 - r * r))) * window_scale;
+            filter[i] = sinc * window;
+            sums[i % up_] += filter[i];
+        }
+        // phase p, tap k (weight of input base - k) at position taps - 1 - k
+        for (std::size_t i = 0; i < length; ++i) {
+            const std::size_t phase = i % up_, k = i / up_;
+            bank_[phase * taps_ + taps_ - 1 - k] = T(filter[i] / sums[phase]);
+        }
+        history_.assign(taps_ - 1, T(0));
+        reset();
+    }
+
+    std::size_t upsampling() const { return up_; }
+    std::size_t downsampling() const { return down_; }
+    std::size_t taps_per_phase() const { return taps_; }
+    double delay() const { return delay_; } // group delay, input samples
+
+    // at most this many outputs for n inputs
+    std::size_t max_output(const std::size_t n) const { return (n * up_) / down_ + 2; }
+
+    // back to the start of a stream (silent history)
+    void reset() {
+        std::fill(history_.begin(), history_.end(), T(0));
+        phase_ = 0;
+        base_ = taps_ - 1;
+    }
+
+    std::size_t process(const T* in, const std::size_t n, T* out) {
+        intrin_detail::join_history(joined_, history_, in, n);
+        const std::size_t end = joined_.size();
+        std::size_t produced = 0;
+        while (base_ < end) {
+            const T* phase_taps = bank_.data() + phase_ * taps_;
+            const T* samples = joined_.data() + base_ + 1 - taps_;
+            auto sum0 = V::zero(), sum1 = V::zero();
+            std::size_t k = 0;
+            for (; k + 2 * V::lanes <= taps_; k += 2 * V::lanes) {
+                sum0 = V::fmadd(V::load(phase_taps + k), V::loadu(samples + k), sum0);
+                sum1 = V::fmadd(V::load(phase_taps + k + V::lanes), V::loadu(samples + k + V::lanes), sum1);
+            }
+            if (k < taps_) { sum0 = V::fmadd(V::load(phase_taps + k), V::loadu(samples + k), sum0); }
+            out[produced++] = V::reduce_add(V::add(sum0, sum1));
+
+            phase_ += down_;
+            base_ += phase_ / up_;
+            phase_ %= up_;
+        }
+        intrin_detail::keep_history(history_, joined_);
+        base_ -= end - history_.size();
+        return produced;
+    }
+
+private:
+    std::size_t up_ = 1, down_ = 1, taps_ = 0;
+    double delay_ = 0.0;
+    std::vector<T, aligned_allocator<T>> bank_;    // up_ phases x taps_
+    std::vector<T, aligned_allocator<T>> history_; // the last taps_ - 1 inputs
+    std::vector<T, aligned_allocator<T>> joined_;  // history + current chunk
+    std::size_t phase_ = 0;                        // of the next output
+    std::size_t base_ = 0;                         // newest input of the next output, index into joined_
+};
+
+/////////////////////// RESAMPLERS - fractional (linear / cubic)
+
+template <typename T>
+class fractional_resampler {
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "float or double samples");
+    using V = vec512<T>;
+    static constexpr std::size_t kept = 3; // inputs before the current chunk that outputs may still need
+
+public:
+    // ratio = output rate / input rate
+    explicit fractional_resampler(const double ratio, const resample_kind kind = resample_kind::cubic) : kind_(kind) {
+        set_ratio(ratio);
+        history_.assign(kept, T(0));
+        reset();
+    }
+
+    // may change between chunks (drift correction); takes effect at the next output
+    void set_ratio(const double ratio) { step_ = 1.0 / ratio; }
+
+    std::size_t max_output(const std::size_t n) const { return static_cast<std::size_t>(double(n) / step_) + 2; }
+
+    void reset() {
+        std::fill(history_.begin(), history_.end(), T(0));
+        position_ = double(kept); // the first input
+    }
+
+    std::size_t process(const T* in, const std::size_t n, T* out) {
+        assert(position_ >= 1.0); // the cubic x0 of the first output is joined_[floor(position_) - 1]
+        intrin_detail::join_history(joined_, history_, in, n);
+        const double last = double(joined_.size()) - 3.0; // the newest position with x[i + 2] available: i <= size - 3
+        // outputs k with floor(position_ + k step) <= last: estimate, then correct it with the same expression
+        // the position update below uses, so the next call starts at floor(position_) >= 1 (x0 in the history)
+        std::size_t count = position_ < last + 1.0 ? static_cast<std::size_t>((last + 1.0 - position_) / step_) : 0;
+        while (std::floor(position_ + double(count) * step_) <= last) { ++count; }
+        while (count > 0 && std::floor(position_ + double(count - 1) * step_) > last) { --count; }
+
+        const T* x = joined_.data();
+        for (std::size_t j = 0; j < count; j += V::lanes) {
+            const double first = position_ + double(j) * step_;
+            const double whole = std::floor(first);
+            __m512i offset;
+            typename V::reg f;
+            intrin_detail::lane_positions(first - whole, step_, offset, f);
+            const auto m = V::up_to(count - j);
+            offset = _mm512_maskz_mov_epi32(static_cast<__mmask16>(m), offset); // lanes past the end gather sample 0
+            const T* base = x + static_cast<std::size_t>(whole);
+            const auto x1 = intrin_detail::table_gather(offset, base);
+            const auto x2 = intrin_detail::table_gather(offset, base + 1);
+            typename V::reg y;
+            if (kind_ == resample_kind::linear) {
+                y = V::fmadd(f, V::sub(x2, x1), x1);
+            } else {
+                // Catmull-Rom: x1 + f/2 (x2 - x0 + f (2 x0 - 5 x1 + 4 x2 - x3 + f (3 (x1 - x2) + x3 - x0)))
+                const auto x0 = intrin_detail::table_gather(offset, base - 1);
+                const auto x3 = intrin_detail::table_gather(offset, base + 2);
+                auto c = V::sub(V::add(V::mul(V::set1(T(3)), V::sub(x1, x2)), x3), x0);
+                c = V::fmadd(f, c, V::sub(V::add(V::add(x0, x0), V::mul(V::set1(T(4)), x2)), V::add(V::mul(V::set1(T(5)), x1), x3)));
+                c = V::fmadd(f, c, V::sub(x2, x0));
+                y = V::fmadd(V::mul(V::set1(T(0.5)), f), c, x1);
+            }
+            V::storeu(out + j, y, m);
+        }
+
+        position_ += double(count) * step_;
+        intrin_detail::keep_history(history_, joined_);
+        position_ -= double(joined_.size() - kept);
+        return count;
+    }
+
+private:
+    resample_kind kind_;
+    double step_ = 1.0;     // input samples per output
+    double position_ = 0.0; // of the next output, in joined_ indices
+    std::vector<T, aligned_allocator<T>> history_;
+    std::vector<T, aligned_allocator<T>> joined_;
+};
+
+#endif //INTRIN__INTRIN_RESAMPLE_H
@@ -0,0 +1,280 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Lock-free ring buffers of cache-line aligned sample blocks for producer / consumer threads.
+// usage: spsc_ring<sample_block<float, 1024>> ring(64);
+//        producer: auto slot = ring.claim();  fill(slot->data);  ring.commit(slot);
+//        consumer: auto slot = ring.acquire();  mean(slot->data, slot->count);  ring.release(slot);
+//
+// Blocks are written and read in place (zero copy): claim / acquire hand out the slot itself, and commit /
+// release publish it to the other side. spsc_ring serves one producer and one consumer thread with plain
+// loads and stores of its two indices; mpmc_ring serves any number of each (bounded queue with a sequence
+// number per slot, one compare-and-swap per claim / acquire). Every index and sequence sits on its own cache
+// line. claim / acquire wait when the ring is full / empty: ring_wait::busy_poll spins with pause, lowest
+// latency at the cost of a core; ring_wait::futex spins briefly, then sleeps (futex on Linux, yield elsewhere).
+// A blocked acquire only returns with a block, so stop consumers with a marker block or use try_acquire.
+
+#ifndef INTRIN__INTRIN_RING_H
+#define INTRIN__INTRIN_RING_H
+
+#include "intrin_generic.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Samples values of T on whole cache lines, so a block can be handed to any of the buffer functions
+// (through data, or as a vector type); count says how many of them are valid
+template <typename T, std::size_t Samples>
+struct alignas(64) sample_block {
+    static_assert(Samples * sizeof(T) % 64 == 0, "a sample block fills whole cache lines");
+    T data[Samples];
+    std::size_t count = Samples;
+};
+
+enum class ring_wait { busy_poll, futex };
+
+// a claimed or acquired slot; false when a try_ call found the ring full / empty
+template <typename Block>
+struct ring_slot {
+    Block* block = nullptr;
+    std::size_t position = 0;
+
+    explicit operator bool() const { return block != nullptr; }
+    Block& operator*() const { return *block; }
+    Block* operator->() const { return block; }
+};
+
+namespace intrin_detail {
+
+constexpr std::size_t cache_line = 64;
+
+inline std::size_t ring_capacity(const std::size_t requested) {
+    std::size_t capacity = 2;
+    while (capacity < requested) { capacity *= 2; }
+    return capacity;
+}
+
+// a value alone on its cache line
+template <typename T>
+struct alignas(cache_line) padded {
+    T value;
+};
+
+// sleeping side of ring_wait::futex: waiters sleep on epoch, notify bumps it and wakes them when any sleep
+class ring_waiter {
+public:
+    template <typename Ready>
+    void wait(const ring_wait policy, Ready&& ready) {
+        for (unsigned spin = 0; !ready(); ++spin) {
+            if (policy == ring_wait::busy_poll || spin < 256) {
+                _mm_pause();
+                continue;
+            }
+            const std::uint32_t seen = epoch_.value.load(std::memory_order_seq_cst);
+            sleepers_.value.fetch_add(1, std::memory_order_seq_cst);
+            if (!ready()) { sleep(seen); }
+            sleepers_.value.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+
+    void notify() {
+        epoch_.value.fetch_add(1, std::memory_order_seq_cst);
+        if (sleepers_.value.load(std::memory_order_seq_cst) != 0) { wake(); }
+    }
+
+private:
+    void sleep(const std::uint32_t seen) {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&epoch_.value), FUTEX_WAIT_PRIVATE, seen, nullptr, nullptr, 0);
+#else
+        if (epoch_.value.load(std::memory_order_seq_cst) == seen) { std::this_thread::yield(); }
+#endif
+    }
+
+    void wake() {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&epoch_.value), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+    padded<std::atomic<std::uint32_t>> epoch_ {{0}};
+    padded<std::atomic<std::uint32_t>> sleepers_ {{0}};
+};
+
+} // namespace intrin_detail
+
+/////////////////////// RING BUFFERS - one producer, one consumer
+
+template <typename Block>
+class spsc_ring {
+public:
+    // capacity is rounded up to a power of two
+    explicit spsc_ring(const std::size_t capacity, const ring_wait policy = ring_wait::busy_poll)
+        : slots_(intrin_detail::ring_capacity(capacity)), mask_(slots_.size() - 1), policy_(policy) {}
+
+    std::size_t capacity() const { return slots_.size(); }
+
+    // producer side
+    ring_slot<Block> try_claim() {
+        const std::size_t head = head_.value.load(std::memory_order_relaxed);
+        if (head - producer_.value.cached_tail == slots_.size()) {
+            producer_.value.cached_tail = tail_.value.load(std::memory_order_acquire);
+            if (head - producer_.value.cached_tail == slots_.size()) { return {}; }
+        }
+        return {&slots_[head & mask_], head};
+    }
+
+    ring_slot<Block> claim() {
+        for (;;) {
+            if (const auto slot = try_claim()) { return slot; }
+            space_.wait(policy_, [this] {
+                return head_.value.load(std::memory_order_relaxed) - tail_.value.load(std::memory_order_acquire) < slots_.size();
+            });
+        }
+    }
+
+    void commit(const ring_slot<Block>& slot) {
+        head_.value.store(slot.position + 1, std::memory_order_release);
+        if (policy_ == ring_wait::futex) { items_.notify(); }
+    }
+
+    // consumer side
+    ring_slot<Block> try_acquire() {
+        const std::size_t tail = tail_.value.load(std::memory_order_relaxed);
+        if (tail == consumer_.value.cached_head) {
+            consumer_.value.cached_head = head_.value.load(std::memory_order_acquire);
+            if (tail == consumer_.value.cached_head) { return {}; }
+        }
+        return {&slots_[tail & mask_], tail};
+    }
+
+    ring_slot<Block> acquire() {
+        for (;;) {
+            if (const auto slot = try_acquire()) { return slot; }
+            items_.wait(policy_, [this] {
+                return head_.value.load(std::memory_order_acquire) != tail_.value.load(std::memory_order_relaxed);
+            });
+        }
+    }
+
+    void release(const ring_slot<Block>& slot) {
+        tail_.value.store(slot.position + 1, std::memory_order_release);
+        if (policy_ == ring_wait::futex) { space_.notify(); }
+    }
+
+private:
+    struct producer_state { std::size_t cached_tail = 0; };
+    struct consumer_state { std::size_t cached_head = 0; };
+
+    std::vector<Block, aligned_allocator<Block>> slots_;
+    const std::size_t mask_;
+    const ring_wait policy_;
+    intrin_detail::padded<std::atomic<std::size_t>> head_ {{0}}; // next slot to commit, written by the producer
+    intrin_detail::padded<producer_state> producer_ {};
+    intrin_detail::padded<std::atomic<std::size_t>> tail_ {{0}}; // next slot to release, written by the consumer
+    intrin_detail::padded<consumer_state> consumer_ {};
+    intrin_detail::ring_waiter items_, space_;
+};
+
+/////////////////////// RING BUFFERS - any number of producers and consumers
+
+template <typename Block>
+class mpmc_ring {
+public:
+    // capacity is rounded up to a power of two
+    explicit mpmc_ring(const std::size_t capacity, const ring_wait policy = ring_wait::busy_poll)
+        : slots_(intrin_detail::ring_capacity(capacity)), sequences_(slots_.size()), mask_(slots_.size() - 1), policy_(policy) {
+        // slot p is free for the producer of position p while its sequence is p, readable while it is p + 1
+        for (std::size_t i = 0; i < sequences_.size(); ++i) { sequences_[i].value.store(i, std::memory_order_relaxed); }
+    }
+
+    std::size_t capacity() const { return slots_.size(); }
+
+    ring_slot<Block> try_claim() { return reserve(enqueue_.value, 0); }
+
+    ring_slot<Block> claim() {
+        for (;;) {
+            if (const auto slot = try_claim()) { return slot; }
+            space_.wait(policy_, [this] { return ready(enqueue_.value, 0); });
+        }
+    }
+
+    void commit(const ring_slot<Block>& slot) {
+        sequences_[slot.position & mask_].value.store(slot.position + 1, std::memory_order_release);
+        if (policy_ == ring_wait::futex) { items_.notify(); }
+    }
+
+    ring_slot<Block> try_acquire() { return reserve(dequeue_.value, 1); }
+
+    ring_slot<Block> acquire() {
+        for (;;) {
+            if (const auto slot = try_acquire()) { return slot; }
+            items_.wait(policy_, [this] { return ready(dequeue_.value, 1); });
+        }
+    }
+
+    void release(const ring_slot<Block>& slot) {
+        sequences_[slot.position & mask_].value.store(slot.position + slots_.size(), std::memory_order_release);
+        if (policy_ == ring_wait::futex) { space_.notify(); }
+    }
+
+private:
+    // takes the slot at index when its sequence reads index + lag (0: free, 1: committed)
+    ring_slot<Block> reserve(std::atomic<std::size_t>& index, const std::size_t lag) {
+        std::size_t position = index.load(std::memory_order_relaxed);
+        for (;;) {
+            const std::size_t sequence = sequences_[position & mask_].value.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + lag));
+            if (difference == 0) {
+                if (index.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { return {&slots_[position & mask_], position}; }
+            } else if (difference < 0) {
+                return {};
+            } else {
+                position = index.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool ready(const std::atomic<std::size_t>& index, const std::size_t lag) const {
+        const std::size_t position = index.load(std::memory_order_relaxed);
+        return static_cast<std::ptrdiff_t>(sequences_[position & mask_].value.load(std::memory_order_acquire) - (position + lag)) >= 0;
+    }
+
+    std::vector<Block, aligned_allocator<Block>> slots_;
+    std::vector<intrin_detail::padded<std::atomic<std::size_t>>, aligned_allocator<intrin_detail::padded<std::atomic<std::size_t>>>> sequences_;
+    const std::size_t mask_;
+    const ring_wait policy_;
+    intrin_detail::padded<std::atomic<std::size_t>> enqueue_ {{0}};
+    intrin_detail::padded<std::atomic<std::size_t>> dequeue_ {{0}};
+    intrin_detail::ring_waiter items_, space_;
+};
+
+#endif //INTRIN__INTRIN_RING_H
@@ -0,0 +1,400 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Scan, search and stream compaction over int, long long, float and double buffers.
+// usage: simd_inclusive_scan(in, out, count); simd_exclusive_scan(in, out, count, init);
+//        simd_find_first(buffer, count, above(0.5f)); simd_count_if(buffer, count, within(lo, hi));
+//        std::size_t kept = simd_copy_if(in, count, out, above(threshold));
+//
+// The predicates (above, below, equals, within) test a whole register at once and give a lane mask.
+// Compaction is _mm512_mask_compressstoreu_*; builds without AVX512F fall back to an AVX2
+// permute with a lookup table of shuffle indices per mask.
+
+#ifndef INTRIN__INTRIN_SCAN_H
+#define INTRIN__INTRIN_SCAN_H
+
+#include "intrin_generic.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace intrin_detail {
+
+// 256 bit counterpart of vec512, only what the AVX2 fallback of the predicates needs.
+// Compares give a plain bitmask (one bit per lane) through movemask.
+template <typename T>
+struct vec256;
+
+template <>
+struct vec256<float> {
+    using reg = __m256;
+    static constexpr int lanes = 8;
+    static reg loadu(const float* ptr) { return _mm256_loadu_ps(ptr); }
+    static void storeu(float* ptr, const reg vec) { _mm256_storeu_ps(ptr, vec); }
+    static reg set1(const float value) { return _mm256_set1_ps(value); }
+    static int cmp_gt(const reg a, const reg b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+    static int cmp_lt(const reg a, const reg b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+    static int cmp_eq(const reg a, const reg b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    static int cmp_ge(const reg a, const reg b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+    static reg permute(const reg vec, const __m256i index) { return _mm256_permutevar8x32_ps(vec, index); }
+};
+
+template <>
+struct vec256<double> {
+    using reg = __m256d;
+    static constexpr int lanes = 4;
+    static reg loadu(const double* ptr) { return _mm256_loadu_pd(ptr); }
+    static void storeu(double* ptr, const reg vec) { _mm256_storeu_pd(ptr, vec); }
+    static reg set1(const double value) { return _mm256_set1_pd(value); }
+    static int cmp_gt(const reg a, const reg b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ)); }
+    static int cmp_lt(const reg a, const reg b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)); }
+    static int cmp_eq(const reg a, const reg b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+    static int cmp_ge(const reg a, const reg b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ)); }
+    static reg permute(const reg vec, const __m256i index) {
+        return _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(vec), index));
+    }
+};
+
+template <>
+struct vec256<int> {
+    using reg = __m256i;
+    static constexpr int lanes = 8;
+    static reg loadu(const int* ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+    static void storeu(int* ptr, const reg vec) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec); }
+    static reg set1(const int value) { return _mm256_set1_epi32(value); }
+    static int bits(const reg vec) { return _mm256_movemask_ps(_mm256_castsi256_ps(vec)); }
+    static int cmp_gt(const reg a, const reg b) { return bits(_mm256_cmpgt_epi32(a, b)); }
+    static int cmp_lt(const reg a, const reg b) { return bits(_mm256_cmpgt_epi32(b, a)); }
+    static int cmp_eq(const reg a, const reg b) { return bits(_mm256_cmpeq_epi32(a, b)); }
+    static int cmp_ge(const reg a, const reg b) { return ~cmp_lt(a, b) & 0xff; }
+    static reg permute(const reg vec, const __m256i index) { return _mm256_permutevar8x32_epi32(vec, index); }
+};
+
+template <>
+struct vec256<long long int> {
+    using reg = __m256i;
+    static constexpr int lanes = 4;
+    static reg loadu(const long long int* ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+    static void storeu(long long int* ptr, const reg vec) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec); }
+    static reg set1(const long long int value) { return _mm256_set1_epi64x(value); }
+    static int bits(const reg vec) { return _mm256_movemask_pd(_mm256_castsi256_pd(vec)); }
+    static int cmp_gt(const reg a, const reg b) { return bits(_mm256_cmpgt_epi64(a, b)); }
+    static int cmp_lt(const reg a, const reg b) { return bits(_mm256_cmpgt_epi64(b, a)); }
+    static int cmp_eq(const reg a, const reg b) { return bits(_mm256_cmpeq_epi64(a, b)); }
+    static int cmp_ge(const reg a, const reg b) { return ~cmp_lt(a, b) & 0xf; }
+    static reg permute(const reg vec, const __m256i index) { return _mm256_permutevar8x32_epi32(vec, index); }
+};
+
+// Shuffle indices that move the lanes selected by a movemask to the front, one byte per 32 bit lane:
+// 256 entries for 8 lane registers, 16 entries for 4 lane registers (two 32 bit halves per lane).
+struct compress_table {
+    unsigned long long lanes8[256];
+    unsigned long long lanes4[16];
+
+    constexpr compress_table() : lanes8(), lanes4() {
+        for (int m = 0; m < 256; ++m) {
+            unsigned long long entry = 0;
+            int out = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+                if (m & (1 << lane)) { entry |= static_cast<unsigned long long>(lane) << (8 * out++); }
+            }
+            lanes8[m] = entry;
+        }
+        for (int m = 0; m < 16; ++m) {
+            unsigned long long entry = 0;
+            int out = 0;
+            for (int lane = 0; lane < 4; ++lane) {
+                if (m & (1 << lane)) {
+                    entry |= static_cast<unsigned long long>(2 * lane) << (8 * out++);
+                    entry |= static_cast<unsigned long long>(2 * lane + 1) << (8 * out++);
+                }
+            }
+            lanes4[m] = entry;
+        }
+    }
+};
+
+inline constexpr compress_table compress_lut {};
+
+inline __m256i compress_indices(const int bits, const int lanes) {
+    const unsigned long long entry = lanes == 8 ? compress_lut.lanes8[bits] : compress_lut.lanes4[bits];
+    return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long int>(entry)));
+}
+
+// lanes moved up by Count, zeros shifted in at the bottom
+template <typename T, int Count>
+typename vec512<T>::reg shift_lanes_up(const typename vec512<T>::reg vec) {
+    if constexpr (std::is_same<T, float>::value) {
+        return _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(vec), _mm512_setzero_si512(), 16 - Count));
+    } else if constexpr (std::is_same<T, double>::value) {
+        return _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(vec), _mm512_setzero_si512(), 8 - Count));
+    } else if constexpr (vec512<T>::lanes == 16) {
+        return _mm512_alignr_epi32(vec, _mm512_setzero_si512(), 16 - Count);
+    } else {
+        return _mm512_alignr_epi64(vec, _mm512_setzero_si512(), 8 - Count);
+    }
+}
+
+// prefix sum inside one register, log2(lanes) shift-and-add steps
+template <typename T>
+typename vec512<T>::reg register_prefix_sum(typename vec512<T>::reg vec) {
+    using V = vec512<T>;
+    vec = V::add(vec, shift_lanes_up<T, 1>(vec));
+    vec = V::add(vec, shift_lanes_up<T, 2>(vec));
+    vec = V::add(vec, shift_lanes_up<T, 4>(vec));
+    if constexpr (V::lanes == 16) { vec = V::add(vec, shift_lanes_up<T, 8>(vec)); }
+    return vec;
+}
+
+template <typename T>
+typename vec512<T>::reg broadcast_last_lane(const typename vec512<T>::reg vec) {
+    using V = vec512<T>;
+    return V::permute(V::lanes == 16 ? _mm512_set1_epi32(15) : _mm512_set1_epi64(7), vec);
+}
+
+template <typename T>
+typename vec512<T>::mask load_mask(const std::size_t remaining) {
+    using V = vec512<T>;
+    return remaining >= static_cast<std::size_t>(V::lanes) ? static_cast<typename V::mask>(~typename V::mask(0))
+                                                           : V::tail(remaining);
+}
+
+} // namespace intrin_detail
+
+/////////////////////// PREDICATES - a register (512 or 256 bit) gives a lane mask, a scalar gives a bool
+
+template <typename T>
+struct above_predicate {
+    T threshold;
+    typename vec512<T>::mask operator()(const typename vec512<T>::reg vec) const {
+        return vec512<T>::cmp_gt(vec, vec512<T>::set1(threshold));
+    }
+    int operator()(const typename intrin_detail::vec256<T>::reg vec) const {
+        return intrin_detail::vec256<T>::cmp_gt(vec, intrin_detail::vec256<T>::set1(threshold));
+    }
+    bool operator()(const T value) const { return value > threshold; }
+};
+
+template <typename T>
+struct below_predicate {
+    T threshold;
+    typename vec512<T>::mask operator()(const typename vec512<T>::reg vec) const {
+        return vec512<T>::cmp_lt(vec, vec512<T>::set1(threshold));
+    }
+    int operator()(const typename intrin_detail::vec256<T>::reg vec) const {
+        return intrin_detail::vec256<T>::cmp_lt(vec, intrin_detail::vec256<T>::set1(threshold));
+    }
+    bool operator()(const T value) const { return value < threshold; }
+};
+
+template <typename T>
+struct equals_predicate {
+    T value;
+    typename vec512<T>::mask operator()(const typename vec512<T>::reg vec) const {
+        return vec512<T>::cmp_eq(vec, vec512<T>::set1(value));
+    }
+    int operator()(const typename intrin_detail::vec256<T>::reg vec) const {
+        return intrin_detail::vec256<T>::cmp_eq(vec, intrin_detail::vec256<T>::set1(value));
+    }
+    bool operator()(const T other) const { return other == value; }
+};
+
+// lo <= x < hi
+template <typename T>
+struct within_predicate {
+    T lo;
+    T hi;
+    typename vec512<T>::mask operator()(const typename vec512<T>::reg vec) const {
+        return vec512<T>::cmp_le(vec512<T>::set1(lo), vec) & vec512<T>::cmp_lt(vec, vec512<T>::set1(hi));
+    }
+    int operator()(const typename intrin_detail::vec256<T>::reg vec) const {
+        using W = intrin_detail::vec256<T>;
+        return W::cmp_ge(vec, W::set1(lo)) & W::cmp_lt(vec, W::set1(hi));
+    }
+    bool operator()(const T value) const { return lo <= value && value < hi; }
+};
+
+template <typename T> above_predicate<T> above(const T threshold) { return {threshold}; }
+template <typename T> below_predicate<T> below(const T threshold) { return {threshold}; }
+template <typename T> equals_predicate<T> equals(const T value) { return {value}; }
+template <typename T> within_predicate<T> within(const T lo, const T hi) { return {lo, hi}; }
+
+/////////////////////// BUFFER FUNCTIONS - int, long long, float and double
+
+#ifdef __AVX512F__
+
+// out[i] = in[0] + ... + in[i]; in and out may be the same buffer
+template <typename T>
+void simd_inclusive_scan(const T* in, T* out, const std::size_t length) {
+    using V = vec512<T>;
+    auto carry = V::zero();
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const auto m = intrin_detail::load_mask<T>(length - i);
+        const auto sums = V::add(intrin_detail::register_prefix_sum<T>(V::loadu(in + i, m)), carry);
+        V::storeu(out + i, sums, m);
+        carry = intrin_detail::broadcast_last_lane<T>(sums);
+    }
+}
+
+// out[i] = init + in[0] + ... + in[i - 1]; in and out may be the same buffer
+template <typename T>
+void simd_exclusive_scan(const T* in, T* out, const std::size_t length, const T init = T(0)) {
+    using V = vec512<T>;
+    auto carry = V::set1(init);
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const auto m = intrin_detail::load_mask<T>(length - i);
+        const auto sums = intrin_detail::register_prefix_sum<T>(V::loadu(in + i, m));
+        V::storeu(out + i, V::add(intrin_detail::shift_lanes_up<T, 1>(sums), carry), m);
+        carry = V::add(carry, intrin_detail::broadcast_last_lane<T>(sums));
+    }
+}
+
+// Summed-area table of a row-major plane: out[y][x] = sum of in[0..y][0..x].
+// Each row is scanned, then the row above is added with whole registers.
+template <typename T>
+void simd_integral_image(const T* in, T* out, const std::size_t width, const std::size_t height) {
+    using V = vec512<T>;
+    for (std::size_t y = 0; y < height; ++y) {
+        T* row = out + y * width;
+        simd_inclusive_scan(in + y * width, row, width);
+        if (y == 0) { continue; }
+        const T* above_row = row - width;
+        for (std::size_t x = 0; x < width; x += V::lanes) {
+            const auto m = intrin_detail::load_mask<T>(width - x);
+            V::storeu(row + x, V::add(V::loadu(row + x, m), V::loadu(above_row + x, m)), m);
+        }
+    }
+}
+
+// index of the first element matching the predicate, length if there is none
+template <typename T, typename Predicate>
+std::size_t simd_find_first(const T* data, const std::size_t length, const Predicate& predicate) {
+    using V = vec512<T>;
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const auto m = intrin_detail::load_mask<T>(length - i);
+        const unsigned int hits = static_cast<unsigned int>(m & predicate(V::loadu(data + i, m)));
+        if (hits != 0) { return i + static_cast<std::size_t>(__builtin_ctz(hits)); }
+    }
+    return length;
+}
+
+template <typename T, typename Predicate>
+std::size_t simd_count_if(const T* data, const std::size_t length, const Predicate& predicate) {
+    using V = vec512<T>;
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const auto m = intrin_detail::load_mask<T>(length - i);
+        count += static_cast<std::size_t>(__builtin_popcount(m & predicate(V::loadu(data + i, m))));
+    }
+    return count;
+}
+
+// Copies the matching elements, in order, to the front of out and returns how many there were.
+// out needs room for length elements; out == in filters in place.
+template <typename T, typename Predicate>
+std::size_t simd_copy_if(const T* in, const std::size_t length, T* out, const Predicate& predicate) {
+    using V = vec512<T>;
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const auto m = intrin_detail::load_mask<T>(length - i);
+        const auto vec = V::loadu(in + i, m);
+        const auto hits = static_cast<typename V::mask>(m & predicate(vec));
+        V::compress_storeu(out + kept, hits, vec);
+        kept += static_cast<std::size_t>(__builtin_popcount(hits));
+    }
+    return kept;
+}
+
+#else // AVX2: movemask + lookup table permute, the scans stay scalar
+
+template <typename T>
+void simd_inclusive_scan(const T* in, T* out, const std::size_t length) {
+    T sum = T(0);
+    for (std::size_t i = 0; i < length; ++i) { sum += in[i]; out[i] = sum; }
+}
+
+template <typename T>
+void simd_exclusive_scan(const T* in, T* out, const std::size_t length, const T init = T(0)) {
+    T sum = init;
+    for (std::size_t i = 0; i < length; ++i) { const T value = in[i]; out[i] = sum; sum += value; }
+}
+
+template <typename T>
+void simd_integral_image(const T* in, T* out, const std::size_t width, const std::size_t height) {
+    for (std::size_t y = 0; y < height; ++y) {
+        T* row = out + y * width;
+        simd_inclusive_scan(in + y * width, row, width);
+        if (y == 0) { continue; }
+        for (std::size_t x = 0; x < width; ++x) { row[x] += row[x - width]; }
+    }
+}
+
+template <typename T, typename Predicate>
+std::size_t simd_find_first(const T* data, const std::size_t length, const Predicate& predicate) {
+    using W = intrin_detail::vec256<T>;
+    std::size_t i = 0;
+    for (; i + W::lanes <= length; i += W::lanes) {
+        const int hits = predicate(W::loadu(data + i));
+        if (hits != 0) { return i + static_cast<std::size_t>(__builtin_ctz(static_cast<unsigned int>(hits))); }
+    }
+    for (; i < length; ++i) {
+        if (predicate(data[i])) { return i; }
+    }
+    return length;
+}
+
+template <typename T, typename Predicate>
+std::size_t simd_count_if(const T* data, const std::size_t length, const Predicate& predicate) {
+    using W = intrin_detail::vec256<T>;
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + W::lanes <= length; i += W::lanes) {
+        count += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned int>(predicate(W::loadu(data + i)))));
+    }
+    for (; i < length; ++i) {
+        count += predicate(data[i]) ? 1 : 0;
+    }
+    return count;
+}
+
+// The permuted register is always stored whole; the lanes past the kept ones are overwritten by
+// the next store, and kept + lanes never passes i + lanes, so out (room for length) is enough.
+template <typename T, typename Predicate>
+std::size_t simd_copy_if(const T* in, const std::size_t length, T* out, const Predicate& predicate) {
+    using W = intrin_detail::vec256<T>;
+    std::size_t kept = 0;
+    std::size_t i = 0;
+    for (; i + W::lanes <= length; i += W::lanes) {
+        const auto vec = W::loadu(in + i);
+        const int hits = predicate(vec);
+        W::storeu(out + kept, W::permute(vec, intrin_detail::compress_indices(hits, W::lanes)));
+        kept += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned int>(hits)));
+    }
+    for (; i < length; ++i) {
+        if (predicate(in[i])) { out[kept++] = in[i]; }
+    }
+    return kept;
+}
+
+#endif // __AVX512F__
+
+#endif //INTRIN__INTRIN_SCAN_H
@@ -0,0 +1,541 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Sorting and selection over int, long long, float and double buffers (ascending).
+// usage: simd_sort(buffer, count); simd_argsort(buffer, count, indices);
+//        simd_nth_element(buffer, count, nth); simd_top_k(buffer, count, k, out);
+//
+// Quicksort in the style of x86-simd-sort: the partition step compress-stores the elements below
+// the pivot to the left end and the rest to the right end, in place. Ranges of up to 8 registers
+// are finished with a bitonic sorting network held entirely in registers.
+// NaNs are moved to the end of the buffer before sorting. None of the sorts is stable: equal keys, and the
+// positions simd_argsort / simd_arg_top_k return for equal elements, come out in no particular order.
+// AVX-512F only, like the rest of the buffer functions: the partitions rely on its compress stores and
+// 16 / 8 lane masks, which AVX2 has no single-instruction equivalent for.
+
+#ifndef INTRIN__INTRIN_SORT_H
+#define INTRIN__INTRIN_SORT_H
+
+#include "intrin_generic.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace intrin_detail {
+
+// payload (index) lanes have the width of the key lanes: int for 16 lane keys, long long for 8 lane keys
+template <typename T>
+using sort_index_t = typename std::conditional<vec512<T>::lanes == 16, int, long long int>::type;
+
+template <int Lanes>
+inline __m512i lane_iota() {
+    return Lanes == 16 ? _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+                       : _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+}
+
+// permute index i -> i ^ distance
+template <int Lanes>
+inline __m512i lane_xor_perm(const int distance) {
+    return _mm512_xor_si512(lane_iota<Lanes>(), Lanes == 16 ? _mm512_set1_epi32(distance) : _mm512_set1_epi64(distance));
+}
+
+// permute index i -> Lanes - 1 - i
+template <int Lanes>
+inline __m512i lane_reverse_perm() {
+    return Lanes == 16 ? _mm512_sub_epi32(_mm512_set1_epi32(15), lane_iota<Lanes>())
+                       : _mm512_sub_epi64(_mm512_set1_epi64(7), lane_iota<Lanes>());
+}
+
+// lanes that keep the larger value of the pair (i, i ^ distance) in the bitonic stage of block size block
+template <int Lanes>
+inline unsigned int bitonic_max_lanes(const int block, const int distance) {
+    unsigned int bits = 0;
+    for (int i = 0; i < Lanes; ++i) {
+        if (((i & distance) != 0) != ((i & block) != 0)) { bits |= 1u << i; }
+    }
+    return bits;
+}
+
+template <typename T, bool Payload>
+struct sort_kernel {
+    using V = vec512<T>;
+    using I = sort_index_t<T>;
+    using P = vec512<I>;
+    using reg = typename V::reg;
+    using mask = typename V::mask;
+    static constexpr int lanes = V::lanes;
+    static constexpr int small_registers = 8;
+
+    // keys with payload compare as (key, index) pairs, so the networks have a strict order and the
+    // padding lanes (max key, max index) always sort behind real elements
+    static mask less(const reg a, const __m512i a_index, const reg b, const __m512i b_index) {
+        if constexpr (Payload) {
+            return V::cmp_lt(a, b) | (V::cmp_eq(a, b) & P::cmp_lt(a_index, b_index));
+        } else {
+            (void)a_index; (void)b_index;
+            return V::cmp_lt(a, b);
+        }
+    }
+
+    // compare-exchange of every lane with the lane at perm; lanes in max_lanes keep the larger one
+    static void exchange(reg& key, __m512i& index, const __m512i perm, const mask max_lanes) {
+        const reg other = V::permute(perm, key);
+        if constexpr (Payload) {
+            const __m512i other_index = P::permute(perm, index);
+            const mask other_less = less(other, other_index, key, index);
+            const mask other_greater = less(key, index, other, other_index);
+            const mask take_other = static_cast<mask>((~max_lanes & other_less) | (max_lanes & other_greater));
+            key = V::blend(take_other, key, other);
+            index = P::blend(take_other, index, other_index);
+        } else {
+            key = V::blend(max_lanes, V::min(key, other), V::max(key, other));
+        }
+    }
+
+    // a gets the lane-wise smaller, b the lane-wise larger
+    static void exchange(reg& a, __m512i& a_index, reg& b, __m512i& b_index) {
+        if constexpr (Payload) {
+            const mask swap = less(b, b_index, a, a_index);
+            const reg low = V::blend(swap, a, b);
+            const __m512i low_index = P::blend(swap, a_index, b_index);
+            b = V::blend(swap, b, a);
+            b_index = P::blend(swap, b_index, a_index);
+            a = low;
+            a_index = low_index;
+        } else {
+            const reg low = V::min(a, b);
+            b = V::max(a, b);
+            a = low;
+        }
+    }
+
+    static void reverse(reg& key, __m512i& index) {
+        const __m512i perm = lane_reverse_perm<lanes>();
+        key = V::permute(perm, key);
+        if constexpr (Payload) { index = P::permute(perm, index); }
+    }
+
+    // full bitonic sort of one register
+    static void sort_register(reg& key, __m512i& index) {
+        for (int block = 2; block <= lanes; block *= 2) {
+            for (int distance = block / 2; distance > 0; distance /= 2) {
+                exchange(key, index, lane_xor_perm<lanes>(distance),
+                         static_cast<mask>(bitonic_max_lanes<lanes>(block, distance)));
+            }
+        }
+    }
+
+    // sorts a bitonic register ascending
+    static void clean_register(reg& key, __m512i& index) {
+        for (int distance = lanes / 2; distance > 0; distance /= 2) {
+            exchange(key, index, lane_xor_perm<lanes>(distance),
+                     static_cast<mask>(bitonic_max_lanes<lanes>(lanes, distance)));
+        }
+    }
+
+    // sorts count registers (a power of two) as one sequence of count * lanes elements
+    static void sort_registers(reg* key, __m512i* index, const int count) {
+        for (int r = 0; r < count; ++r) { sort_register(key[r], index[r]); }
+
+        for (int run = 1; run < count; run *= 2) {
+            for (int start = 0; start < count; start += 2 * run) {
+                // first half-cleaner against the second run read backwards
+                for (int r = 0; r < run; ++r) { reverse(key[start + run + r], index[start + run + r]); }
+                for (int r = 0; r < run / 2; ++r) {
+                    std::swap(key[start + run + r], key[start + 2 * run - 1 - r]);
+                    std::swap(index[start + run + r], index[start + 2 * run - 1 - r]);
+                }
+                for (int r = 0; r < run; ++r) {
+                    exchange(key[start + r], index[start + r], key[start + run + r], index[start + run + r]);
+                }
+                // both halves are bitonic now, finish them across registers, then inside
+                for (int half = start; half < start + 2 * run; half += run) {
+                    for (int distance = run / 2; distance > 0; distance /= 2) {
+                        for (int r = half; r < half + run; ++r) {
+                            if (((r - half) & distance) == 0) {
+                                exchange(key[r], index[r], key[r + distance], index[r + distance]);
+                            }
+                        }
+                    }
+                    for (int r = half; r < half + run; ++r) { clean_register(key[r], index[r]); }
+                }
+            }
+        }
+    }
+
+    // whole range in registers, padded with the largest key (and largest index)
+    static void sort_small(T* keys, I* indices, const std::size_t length) {
+        reg key[small_registers];
+        __m512i index[small_registers];
+        const std::size_t used = (length + lanes - 1) / lanes;
+        int count = 1;
+        while (static_cast<std::size_t>(count) < used) { count *= 2; }
+
+        const reg pad = V::set1(std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                      : std::numeric_limits<T>::max());
+        const __m512i pad_index = P::set1(std::numeric_limits<I>::max());
+        for (int r = 0; r < count; ++r) {
+            const std::size_t offset = static_cast<std::size_t>(r) * lanes;
+            const std::size_t left = offset < length ? length - offset : 0;
+            const mask m = left >= static_cast<std::size_t>(lanes) ? static_cast<mask>(~mask(0)) : V::tail(left);
+            key[r] = V::blend(m, pad, V::loadu(keys + offset, m));
+            index[r] = pad_index;
+            if constexpr (Payload) { index[r] = P::blend(m, pad_index, P::loadu(indices + offset, m)); }
+        }
+
+        sort_registers(key, index, count);
+
+        for (int r = 0; r < count; ++r) {
+            const std::size_t offset = static_cast<std::size_t>(r) * lanes;
+            if (offset >= length) { break; }
+            const std::size_t left = length - offset;
+            const mask m = left >= static_cast<std::size_t>(lanes) ? static_cast<mask>(~mask(0)) : V::tail(left);
+            V::storeu(keys + offset, key[r], m);
+            if constexpr (Payload) { P::storeu(indices + offset, index[r], m); }
+        }
+    }
+
+    // one register worth of partition: below-pivot lanes to the left store, the rest to the right store
+    static void partition_register(T* keys, I* indices, const reg key, const __m512i index, const mask valid,
+                                   const reg pivot, const bool inclusive, std::size_t& left_store, std::size_t& right_store) {
+        const mask below = valid & (inclusive ? V::cmp_le(key, pivot) : V::cmp_lt(key, pivot));
+        const mask above = valid & static_cast<mask>(~below);
+        const int below_count = __builtin_popcount(below);
+        const int above_count = __builtin_popcount(above);
+
+        V::compress_storeu(keys + left_store, below, key);
+        right_store -= above_count;
+        V::compress_storeu(keys + right_store, above, key);
+        if constexpr (Payload) {
+            P::compress_storeu(indices + left_store, below, index);
+            P::compress_storeu(indices + right_store, above, index);
+        } else {
+            (void)indices; (void)index;
+        }
+        left_store += below_count;
+    }
+
+    // In-place partition of [left, right) (at least two registers long), returns the split point.
+    // The first and last registers are held back, which opens one register of room at both ends;
+    // reading the next register from the end with less room keeps the stores off unread data.
+    static std::size_t partition(T* keys, I* indices, std::size_t left, std::size_t right,
+                                 const T pivot_value, const bool inclusive) {
+        const reg pivot = V::set1(pivot_value);
+        const auto load_index = [&](const std::size_t at, const mask m) {
+            if constexpr (Payload) { return P::loadu(indices + at, m); }
+            else { (void)at; (void)m; return _mm512_setzero_si512(); }
+        };
+        const mask full = static_cast<mask>(~mask(0));
+
+        const reg first = V::loadu(keys + left);
+        const __m512i first_index = load_index(left, full);
+        const reg last = V::loadu(keys + right - lanes);
+        const __m512i last_index = load_index(right - lanes, full);
+
+        std::size_t left_store = left;
+        std::size_t right_store = right;
+        left += lanes;
+        right -= lanes;
+
+        // the odd-sized remainder goes first, while both ends have a full register of room
+        const std::size_t remainder = (right - left) % lanes;
+        if (remainder != 0) {
+            const mask m = V::tail(remainder);
+            const reg key = V::loadu(keys + left, m);
+            const __m512i index = load_index(left, m);
+            left += remainder;
+            partition_register(keys, indices, key, index, m, pivot, inclusive, left_store, right_store);
+        }
+
+        while (left < right) {
+            reg key;
+            __m512i index;
+            if (right_store - right < left - left_store) {
+                right -= lanes;
+                key = V::loadu(keys + right);
+                index = load_index(right, full);
+            } else {
+                key = V::loadu(keys + left);
+                index = load_index(left, full);
+                left += lanes;
+            }
+            partition_register(keys, indices, key, index, full, pivot, inclusive, left_store, right_store);
+        }
+
+        partition_register(keys, indices, first, first_index, full, pivot, inclusive, left_store, right_store);
+        partition_register(keys, indices, last, last_index, full, pivot, inclusive, left_store, right_store);
+        return left_store;
+    }
+
+    // median of one register of evenly spaced samples
+    static T choose_pivot(const T* keys, const std::size_t left, const std::size_t right) {
+        alignas(64) T samples[lanes];
+        const std::size_t stride = (right - left) / lanes;
+        for (int i = 0; i < lanes; ++i) { samples[i] = keys[left + i * stride]; }
+        reg key = V::loadu(samples);
+        __m512i index = lane_iota<lanes>();
+        sort_register(key, index);
+        V::storeu(samples, key);
+        return samples[lanes / 2];
+    }
+
+    static void heap_sort(T* keys, I* indices, const std::size_t length) {
+        const auto greater_at = [&](const std::size_t a, const std::size_t b) {
+            if constexpr (Payload) {
+                return keys[a] > keys[b] || (keys[a] == keys[b] && indices[a] > indices[b]);
+            } else {
+                return keys[a] > keys[b];
+            }
+        };
+        const auto swap_at = [&](const std::size_t a, const std::size_t b) {
+            std::swap(keys[a], keys[b]);
+            if constexpr (Payload) { std::swap(indices[a], indices[b]); }
+        };
+        const auto sift_down = [&](std::size_t root, const std::size_t end) {
+            for (std::size_t child = 2 * root + 1; child < end; child = 2 * root + 1) {
+                if (child + 1 < end && greater_at(child + 1, child)) { ++child; }
+                if (!greater_at(child, root)) { return; }
+                swap_at(root, child);
+                root = child;
+            }
+        };
+        for (std::size_t i = length / 2; i-- > 0;) { sift_down(i, length); }
+        for (std::size_t end = length; end-- > 1;) {
+            swap_at(0, end);
+            sift_down(0, end);
+        }
+    }
+
+    // Splits [left, right) around a sampled pivot. When nothing is below the pivot it is the minimum,
+    // so the equal keys are split off instead; they are already in their final place.
+    static void split(T* keys, I* indices, const std::size_t left, const std::size_t right,
+                      std::size_t& low_end, std::size_t& high_begin) {
+        const T pivot = choose_pivot(keys, left, right);
+        std::size_t middle = partition(keys, indices, left, right, pivot, false);
+        if (middle == left) {
+            middle = partition(keys, indices, left, right, pivot, true);
+            low_end = left;
+            high_begin = middle;
+            return;
+        }
+        low_end = middle;
+        high_begin = middle;
+    }
+
+    static void quicksort(T* keys, I* indices, const std::size_t left, const std::size_t right, int depth) {
+        const std::size_t length = right - left;
+        if (length <= static_cast<std::size_t>(small_registers * lanes)) {
+            sort_small(keys + left, Payload ? indices + left : indices, length);
+            return;
+        }
+        if (depth == 0) {
+            heap_sort(keys + left, Payload ? indices + left : indices, length);
+            return;
+        }
+        std::size_t low_end, high_begin;
+        split(keys, indices, left, right, low_end, high_begin);
+        quicksort(keys, indices, left, low_end, depth - 1);
+        quicksort(keys, indices, high_begin, right, depth - 1);
+    }
+
+    // places the nth smallest at nth, smaller ones before and larger ones after it
+    static void select(T* keys, I* indices, std::size_t left, std::size_t right, const std::size_t nth, int depth) {
+        while (right - left > static_cast<std::size_t>(small_registers * lanes)) {
+            if (depth-- == 0) {
+                heap_sort(keys + left, Payload ? indices + left : indices, right - left);
+                return;
+            }
+            std::size_t low_end, high_begin;
+            split(keys, indices, left, right, low_end, high_begin);
+            if (nth < low_end) { right = low_end; }
+            else if (nth >= high_begin) { left = high_begin; }
+            else { return; } // inside the run of keys equal to the pivot
+        }
+        sort_small(keys + left, Payload ? indices + left : indices, right - left);
+    }
+
+    static int depth_limit(std::size_t length) {
+        int depth = 0;
+        while (length > 1) { length >>= 1; depth += 2; }
+        return depth;
+    }
+
+    // moves the NaNs (and their indices) behind everything else, returns the count of the rest
+    static std::size_t move_nans_back(T* keys, I* indices, const std::size_t length) {
+        if constexpr (!std::is_floating_point<T>::value) {
+            (void)keys; (void)indices;
+            return length;
+        } else {
+            std::size_t nan_count = 0;
+            for (std::size_t i = 0; i < length; i += lanes) {
+                const mask m = length - i >= static_cast<std::size_t>(lanes) ? static_cast<mask>(~mask(0)) : V::tail(length - i);
+                const reg key = V::loadu(keys + i, m);
+                nan_count += __builtin_popcount(m & static_cast<mask>(~V::cmp_eq(key, key)));
+            }
+            if (nan_count == 0) { return length; }
+
+            std::vector<I> nan_indices;
+            std::size_t store = 0;
+            for (std::size_t i = 0; i < length; i += lanes) {
+                const mask m = length - i >= static_cast<std::size_t>(lanes) ? static_cast<mask>(~mask(0)) : V::tail(length - i);
+                const reg key = V::loadu(keys + i, m);
+                const mask number = m & V::cmp_eq(key, key);
+                if constexpr (Payload) {
+                    const __m512i index = P::loadu(indices + i, m);
+                    alignas(64) I spilled[lanes];
+                    P::compress_storeu(spilled, static_cast<mask>(m & ~number), index);
+                    nan_indices.insert(nan_indices.end(), spilled, spilled + __builtin_popcount(m & ~number));
+                    P::compress_storeu(indices + store, number, index);
+                }
+                V::compress_storeu(keys + store, number, key);
+                store += __builtin_popcount(number);
+            }
+            for (std::size_t i = store; i < length; ++i) {
+                keys[i] = std::numeric_limits<T>::quiet_NaN();
+                if constexpr (Payload) { indices[i] = nan_indices[i - store]; }
+            }
+            return store;
+        }
+    }
+
+    static void sort(T* keys, I* indices, const std::size_t length) {
+        const std::size_t numbers = move_nans_back(keys, indices, length);
+        quicksort(keys, indices, 0, numbers, depth_limit(numbers));
+    }
+
+    static void nth_element(T* keys, I* indices, const std::size_t length, const std::size_t nth) {
+        const std::size_t numbers = move_nans_back(keys, indices, length);
+        if (nth >= numbers) { return; }
+        select(keys, indices, 0, numbers, nth, depth_limit(numbers));
+    }
+};
+
+} // namespace intrin_detail
+
+/////////////////////// BUFFER FUNCTIONS - int, long long, float and double
+
+// sorts ascending in place
+template <typename T>
+void simd_sort(T* data, const std::size_t length) {
+    intrin_detail::sort_kernel<T, false>::sort(data, nullptr, length);
+}
+
+// Sorts keys ascending and moves values along; any 4 byte type goes with int/float keys and any 8 byte
+// type with long long/double keys. Not stable: partitioning moves equal keys by key alone, and the small
+// range networks and the heap sort break ties on the values' bits (read as int / long long), so equal keys
+// end up in no particular order, neither input order nor value order.
+template <typename T, typename U>
+void simd_key_value_sort(T* keys, U* values, const std::size_t length) {
+    using I = intrin_detail::sort_index_t<T>;
+    static_assert(sizeof(U) == sizeof(I), "values must be as wide as the keys");
+    intrin_detail::sort_kernel<T, true>::sort(keys, reinterpret_cast<I*>(values), length);
+}
+
+// indices[i] is the position in data of the i-th smallest element; data is left untouched. Not stable:
+// the positions of equal elements come out in no particular order, not ascending.
+template <typename T>
+void simd_argsort(const T* data, const std::size_t length, std::size_t* indices) {
+    using I = intrin_detail::sort_index_t<T>;
+    if (length > static_cast<std::size_t>(std::numeric_limits<I>::max())) {
+        for (std::size_t i = 0; i < length; ++i) { indices[i] = i; }
+        std::stable_sort(indices, indices + length, [data](const std::size_t a, const std::size_t b) {
+            return data[a] < data[b] || (data[b] != data[b] && data[a] == data[a]); // NaNs last
+        });
+        return;
+    }
+    std::vector<T> keys(data, data + length);
+    std::vector<I> positions(length);
+    for (std::size_t i = 0; i < length; ++i) { positions[i] = static_cast<I>(i); }
+    intrin_detail::sort_kernel<T, true>::sort(keys.data(), positions.data(), length);
+    for (std::size_t i = 0; i < length; ++i) { indices[i] = static_cast<std::size_t>(positions[i]); }
+}
+
+// like std::nth_element: data[nth] ends up as in a sorted buffer, nothing after it is smaller
+template <typename T>
+void simd_nth_element(T* data, const std::size_t length, const std::size_t nth) {
+    intrin_detail::sort_kernel<T, false>::nth_element(data, nullptr, length, nth);
+}
+
+// like std::partial_sort: the k smallest, sorted, at the front
+template <typename T>
+void simd_partial_sort(T* data, const std::size_t length, const std::size_t k) {
+    if (k == 0) { return; }
+    if (k < length) { simd_nth_element(data, length, k - 1); }
+    simd_sort(data, k < length ? k : length);
+}
+
+// the k largest of data, largest first, into out; data is left untouched
+template <typename T>
+void simd_top_k(const T* data, const std::size_t length, std::size_t k, T* out) {
+    if (k > length) { k = length; }
+    if (k == 0) { return; }
+    std::vector<T> scratch(data, data + length);
+    using kernel = intrin_detail::sort_kernel<T, false>;
+    const std::size_t numbers = kernel::move_nans_back(scratch.data(), nullptr, length);
+    const std::size_t first = numbers > k ? numbers - k : 0;
+    if (first > 0) { kernel::select(scratch.data(), nullptr, 0, numbers, first, kernel::depth_limit(numbers)); }
+    kernel::quicksort(scratch.data(), nullptr, first, numbers, kernel::depth_limit(numbers - first));
+    const std::size_t ranked = numbers - first; // NaNs, if any, fill up the rest
+    for (std::size_t i = 0; i < k; ++i) { out[i] = i < ranked ? scratch[numbers - 1 - i] : scratch[numbers + i - ranked]; }
+}
+
+// positions of the k largest of data, largest first; data is left untouched. Not stable: among equal
+// elements the positions come out in no particular order.
+template <typename T>
+void simd_arg_top_k(const T* data, const std::size_t length, std::size_t k, std::size_t* indices) {
+    using I = intrin_detail::sort_index_t<T>;
+    using kernel = intrin_detail::sort_kernel<T, true>;
+    if (k > length) { k = length; }
+    if (k == 0) { return; }
+    if (length > static_cast<std::size_t>(std::numeric_limits<I>::max())) {
+        std::vector<std::size_t> all(length);
+        simd_argsort(data, length, all.data());
+        std::size_t numbers = length;
+        while (numbers > 0 && data[all[numbers - 1]] != data[all[numbers - 1]]) { --numbers; }
+        for (std::size_t i = 0; i < k; ++i) { indices[i] = i < numbers ? all[numbers - 1 - i] : all[i]; }
+        return;
+    }
+    std::vector<T> keys(data, data + length);
+    std::vector<I> positions(length);
+    for (std::size_t i = 0; i < length; ++i) { positions[i] = static_cast<I>(i); }
+    const std::size_t numbers = kernel::move_nans_back(keys.data(), positions.data(), length);
+    const std::size_t first = numbers > k ? numbers - k : 0;
+    if (first > 0) { kernel::select(keys.data(), positions.data(), 0, numbers, first, kernel::depth_limit(numbers)); }
+    kernel::quicksort(keys.data(), positions.data(), first, numbers, kernel::depth_limit(numbers - first));
+    const std::size_t ranked = numbers - first;
+    for (std::size_t i = 0; i < k; ++i) {
+        indices[i] = static_cast<std::size_t>(i < ranked ? positions[numbers - 1 - i] : positions[numbers + i - ranked]);
+    }
+}
+
+/////////////////////// VECTOR TYPE OVERLOADS - sorts the lanes of any of the types of intrin_generic.h
+
+template <typename T>
+auto simd_sort(T& type_object) -> decltype(simd_sort(type_object.data, std::size(type_object.data))) {
+    simd_sort(type_object.data, std::size(type_object.data));
+}
+
+#endif //INTRIN__INTRIN_SORT_H
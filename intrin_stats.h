@@ -0,0 +1,490 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Bulk statistics over float and double buffers (or any of the vector types, through their data array).
+// usage: running_stats<float> s; s.push(buffer, count); s.mean(); s.variance();
+//        argmax(buffer, count); histogram(buffer, count, lo, hi, counts, bins);
+//
+// All the passes are single pass. Mean and variance use Welford's update in every lane and merge
+// the lanes (and the blocks) with Chan's formula, so there is no sum-of-squares cancellation.
+
+#ifndef INTRIN__INTRIN_STATS_H
+#define INTRIN__INTRIN_STATS_H
+
+#include "intrin_generic.h"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+// Count, mean and sum of squared deviations (M2) of everything pushed so far.
+// Blocks can be pushed and removed again, which gives a sliding window:
+//     s.push(new_block, n); s.remove(oldest_block, n);
+template <typename T>
+struct running_stats {
+    std::size_t count = 0;
+    T mean_value = 0;
+    T m2 = 0;
+
+    T mean() const { return mean_value; }
+    T variance() const { return count > 0 ? m2 / static_cast<T>(count) : T(0); }
+    T sample_variance() const { return count > 1 ? m2 / static_cast<T>(count - 1) : T(0); }
+
+    void reset() { count = 0; mean_value = 0; m2 = 0; }
+
+    // single sample
+    void push(const T value) {
+        ++count;
+        const T delta = value - mean_value;
+        mean_value += delta / static_cast<T>(count);
+        m2 += delta * (value - mean_value);
+    }
+
+    // single sample, must have been pushed before (reverse Welford)
+    void pop(const T value) {
+        if (count <= 1) { reset(); return; }
+        const T delta = value - mean_value;
+        --count;
+        mean_value -= delta / static_cast<T>(count);
+        m2 -= delta * (value - mean_value);
+    }
+
+    // Chan's parallel merge
+    void merge(const running_stats& other) {
+        if (other.count == 0) { return; }
+        if (count == 0) { *this = other; return; }
+        const std::size_t total = count + other.count;
+        const T delta = other.mean_value - mean_value;
+        const T weight = static_cast<T>(other.count) / static_cast<T>(total);
+        mean_value += delta * weight;
+        m2 += other.m2 + delta * delta * static_cast<T>(count) * weight;
+        count = total;
+    }
+
+    // inverse of merge: takes out a part that was merged in before
+    void unmerge(const running_stats& other) {
+        if (other.count == 0) { return; }
+        if (other.count >= count) { reset(); return; }
+        const std::size_t rest = count - other.count;
+        const T rest_mean = (static_cast<T>(count) * mean_value - static_cast<T>(other.count) * other.mean_value)
+                            / static_cast<T>(rest);
+        const T delta = other.mean_value - rest_mean;
+        m2 -= other.m2 + delta * delta * static_cast<T>(rest) * static_cast<T>(other.count) / static_cast<T>(count);
+        if (m2 < T(0)) { m2 = 0; } // rounding
+        mean_value = rest_mean;
+        count = rest;
+    }
+
+    void push(const T* data, std::size_t length);
+    void remove(const T* data, std::size_t length);
+};
+
+// Co-moment of two equally long series, merged the same way as running_stats.
+template <typename T>
+struct running_covariance {
+    std::size_t count = 0;
+    T mean_x = 0;
+    T mean_y = 0;
+    T c2 = 0;
+
+    T covariance() const { return count > 0 ? c2 / static_cast<T>(count) : T(0); }
+    T sample_covariance() const { return count > 1 ? c2 / static_cast<T>(count - 1) : T(0); }
+
+    void push(const T x, const T y) {
+        ++count;
+        const T inv = T(1) / static_cast<T>(count);
+        const T delta_x = x - mean_x;
+        mean_x += delta_x * inv;
+        mean_y += (y - mean_y) * inv;
+        c2 += delta_x * (y - mean_y);
+    }
+
+    void merge(const running_covariance& other) {
+        if (other.count == 0) { return; }
+        if (count == 0) { *this = other; return; }
+        const std::size_t total = count + other.count;
+        const T weight = static_cast<T>(other.count) / static_cast<T>(total);
+        const T delta_x = other.mean_x - mean_x;
+        const T delta_y = other.mean_y - mean_y;
+        mean_x += delta_x * weight;
+        mean_y += delta_y * weight;
+        c2 += other.c2 + delta_x * delta_y * static_cast<T>(count) * weight;
+        count = total;
+    }
+
+    void push(const T* x, const T* y, std::size_t length);
+};
+
+namespace intrin_detail {
+
+// Welford in every lane of two interleaved accumulator sets (two sets hide the add latency),
+// leftovers go through the scalar update. All lanes of a set see the same sample count.
+template <typename T>
+running_stats<T> welford_block(const T* data, const std::size_t length) {
+    using V = vec512<T>;
+    constexpr std::size_t step = 2 * V::lanes;
+    const std::size_t vec_count = length / step;
+
+    running_stats<T> result;
+    if (vec_count > 0) {
+        auto mean_a = V::zero(), mean_b = V::zero();
+        auto m2_a = V::zero(), m2_b = V::zero();
+
+        for (std::size_t i = 0; i < vec_count; ++i) {
+            const auto inv = V::set1(T(1) / static_cast<T>(i + 1));
+            const auto x_a = V::loadu(data + i * step);
+            const auto x_b = V::loadu(data + i * step + V::lanes);
+
+            const auto delta_a = V::sub(x_a, mean_a);
+            const auto delta_b = V::sub(x_b, mean_b);
+            mean_a = V::fmadd(delta_a, inv, mean_a);
+            mean_b = V::fmadd(delta_b, inv, mean_b);
+            m2_a = V::fmadd(delta_a, V::sub(x_a, mean_a), m2_a);
+            m2_b = V::fmadd(delta_b, V::sub(x_b, mean_b), m2_b);
+        }
+
+        alignas(64) T means[2 * V::lanes];
+        alignas(64) T m2s[2 * V::lanes];
+        V::storeu(means, mean_a);
+        V::storeu(means + V::lanes, mean_b);
+        V::storeu(m2s, m2_a);
+        V::storeu(m2s + V::lanes, m2_b);
+
+        for (int lane = 0; lane < 2 * V::lanes; ++lane) {
+            running_stats<T> part;
+            part.count = vec_count;
+            part.mean_value = means[lane];
+            part.m2 = m2s[lane];
+            result.merge(part);
+        }
+    }
+
+    for (std::size_t i = vec_count * step; i < length; ++i) {
+        result.push(data[i]);
+    }
+    return result;
+}
+
+template <typename T>
+running_covariance<T> comoment_block(const T* x, const T* y, const std::size_t length) {
+    using V = vec512<T>;
+    const std::size_t vec_count = length / V::lanes;
+
+    running_covariance<T> result;
+    if (vec_count > 0) {
+        auto mean_x = V::zero(), mean_y = V::zero(), c2 = V::zero();
+
+        for (std::size_t i = 0; i < vec_count; ++i) {
+            const auto inv = V::set1(T(1) / static_cast<T>(i + 1));
+            const auto x_vec = V::loadu(x + i * V::lanes);
+            const auto y_vec = V::loadu(y + i * V::lanes);
+
+            const auto delta_x = V::sub(x_vec, mean_x);
+            mean_x = V::fmadd(delta_x, inv, mean_x);
+            mean_y = V::fmadd(V::sub(y_vec, mean_y), inv, mean_y);
+            c2 = V::fmadd(delta_x, V::sub(y_vec, mean_y), c2);
+        }
+
+        alignas(64) T means_x[V::lanes];
+        alignas(64) T means_y[V::lanes];
+        alignas(64) T c2s[V::lanes];
+        V::storeu(means_x, mean_x);
+        V::storeu(means_y, mean_y);
+        V::storeu(c2s, c2);
+
+        for (int lane = 0; lane < V::lanes; ++lane) {
+            running_covariance<T> part;
+            part.count = vec_count;
+            part.mean_x = means_x[lane];
+            part.mean_y = means_y[lane];
+            part.c2 = c2s[lane];
+            result.merge(part);
+        }
+    }
+
+    for (std::size_t i = vec_count * V::lanes; i < length; ++i) {
+        result.push(x[i], y[i]);
+    }
+    return result;
+}
+
+// block number (not element index) of the best value seen by each lane, 32 bit per lane for floats
+// and 64 bit per lane for doubles, so both fill one __m512i and blend with the value mask
+inline __m512i index_blend(const __mmask16 m, const __m512i a, const __m512i b) { return _mm512_mask_blend_epi32(m, a, b); }
+inline __m512i index_blend(const __mmask8 m, const __m512i a, const __m512i b) { return _mm512_mask_blend_epi64(m, a, b); }
+inline __m512i index_set1(const __mmask16, const long long int value) { return _mm512_set1_epi32(static_cast<int>(value)); }
+inline __m512i index_set1(const __mmask8, const long long int value) { return _mm512_set1_epi64(value); }
+inline long long int index_lane(const __m512i vec, const __mmask16, const int lane) {
+    alignas(64) int lanes[16];
+    _mm512_store_si512(lanes, vec);
+    return lanes[lane];
+}
+inline long long int index_lane(const __m512i vec, const __mmask8, const int lane) {
+    alignas(64) long long int lanes[8];
+    _mm512_store_si512(lanes, vec);
+    return lanes[lane];
+}
+
+// first index of the smallest (or largest) value; NaNs are skipped (0 when every value is NaN)
+template <bool Largest, typename T>
+std::size_t arg_extreme(const T* data, const std::size_t length) {
+    using V = vec512<T>;
+    using mask = typename V::mask;
+    if (length == 0) { return 0; }
+
+    const std::size_t vec_count = length / V::lanes;
+    std::size_t best_index = 0;
+    T best_value = T(0);
+    bool found = false; // best_value holds a (non-NaN) value
+
+    if (vec_count > 0) {
+        auto best = V::loadu(data);
+        auto best_block = index_set1(mask(), 0);
+
+        for (std::size_t i = 1; i < vec_count; ++i) {
+            const auto vec = V::loadu(data + i * V::lanes);
+            // lanes still holding NaN take the next value, so a NaN only stays where the lane saw nothing else
+            const mask better = static_cast<mask>((Largest ? V::cmp_gt(vec, best) : V::cmp_lt(vec, best)) | ~V::cmp_eq(best, best));
+            best = V::blend(better, best, vec);
+            best_block = index_blend(better, best_block, index_set1(mask(), static_cast<long long int>(i)));
+        }
+
+        alignas(64) T values[V::lanes];
+        V::storeu(values, best);
+        for (int lane = 0; lane < V::lanes; ++lane) {
+            if (!(values[lane] == values[lane])) { continue; }
+            const std::size_t index = static_cast<std::size_t>(index_lane(best_block, mask(), lane)) * V::lanes + lane;
+            const bool better = Largest ? values[lane] > best_value : values[lane] < best_value;
+            if (!found || better || (values[lane] == best_value && index < best_index)) {
+                best_value = values[lane];
+                best_index = index;
+                found = true;
+            }
+        }
+    }
+
+    for (std::size_t i = vec_count * V::lanes; i < length; ++i) {
+        if (data[i] == data[i] && (!found || (Largest ? data[i] > best_value : data[i] < best_value))) {
+            best_value = data[i];
+            best_index = i;
+            found = true;
+        }
+    }
+    return best_index;
+}
+
+// bin numbers of one register as 32 bit indices in a __m512i
+inline __m512i truncate_to_int32(const __m512 vec) { return _mm512_cvttps_epi32(vec); }
+inline __m512i truncate_to_int32(const __m512d vec) { return _mm512_castsi256_si512(_mm512_cvttpd_epi32(vec)); }
+
+// van Herk / Gil-Werman: running extremes inside blocks of the window length, forwards and backwards,
+// then every output is one vector min (max) of the backward value at i and the forward value at i + w - 1.
+// Short windows are cheaper as w overlapping loads. Both picks skip NaNs (as argmin / argmax do), so a
+// window is NaN only when all of it is; min_ps / max_ps alone would return b whenever either is NaN.
+template <bool Largest, typename T>
+void sliding_extreme(const T* data, const std::size_t length, const std::size_t window, T* out) {
+    using V = vec512<T>;
+    if (window == 0 || length < window) { return; }
+    const std::size_t out_length = length - window + 1;
+    const auto pick = [](const typename V::reg a, const typename V::reg b) {
+        const auto extreme = Largest ? V::max(a, b) : V::min(a, b); // b when either is NaN
+        if constexpr (std::is_floating_point_v<T>) {
+            return V::blend(static_cast<typename V::mask>(~V::cmp_eq(b, b)), extreme, a);
+        } else {
+            return extreme;
+        }
+    };
+    const auto pick_scalar = [](const T a, const T b) {
+        if (!(b == b)) { return a; }
+        if (!(a == a)) { return b; }
+        return Largest ? (a < b ? b : a) : (b < a ? b : a);
+    };
+
+    if (window <= 32) {
+        std::size_t i = 0;
+        for (; i + V::lanes <= out_length; i += V::lanes) {
+            auto acc = V::loadu(data + i);
+            for (std::size_t k = 1; k < window; ++k) {
+                acc = pick(acc, V::loadu(data + i + k));
+            }
+            V::storeu(out + i, acc);
+        }
+        if (i < out_length) {
+            const auto m = V::tail(out_length - i);
+            auto acc = V::loadu(data + i, m);
+            for (std::size_t k = 1; k < window; ++k) {
+                acc = pick(acc, V::loadu(data + i + k, m));
+            }
+            V::storeu(out + i, acc, m);
+        }
+        return;
+    }
+
+    std::vector<T> forward(length);
+    std::vector<T> backward(length);
+    for (std::size_t start = 0; start < length; start += window) {
+        const std::size_t end = start + window < length ? start + window : length;
+        forward[start] = data[start];
+        for (std::size_t i = start + 1; i < end; ++i) { forward[i] = pick_scalar(forward[i - 1], data[i]); }
+        backward[end - 1] = data[end - 1];
+        for (std::size_t i = end - 1; i > start; --i) { backward[i - 1] = pick_scalar(backward[i], data[i - 1]); }
+    }
+
+    std::size_t i = 0;
+    for (; i + V::lanes <= out_length; i += V::lanes) {
+        V::storeu(out + i, pick(V::loadu(backward.data() + i), V::loadu(forward.data() + i + window - 1)));
+    }
+    if (i < out_length) {
+        const auto m = V::tail(out_length - i);
+        V::storeu(out + i, pick(V::loadu(backward.data() + i, m), V::loadu(forward.data() + i + window - 1, m)), m);
+    }
+}
+
+} // namespace intrin_detail
+
+template <typename T>
+void running_stats<T>::push(const T* data, const std::size_t length) {
+    merge(intrin_detail::welford_block(data, length));
+}
+
+template <typename T>
+void running_stats<T>::remove(const T* data, const std::size_t length) {
+    unmerge(intrin_detail::welford_block(data, length));
+}
+
+template <typename T>
+void running_covariance<T>::push(const T* x, const T* y, const std::size_t length) {
+    merge(intrin_detail::comoment_block(x, y, length));
+}
+
+/////////////////////// BUFFER FUNCTIONS - float and double
+
+template <typename T>
+T mean(const T* data, const std::size_t length) {
+    return intrin_detail::welford_block(data, length).mean();
+}
+
+// population variance (divides by length)
+template <typename T>
+T variance(const T* data, const std::size_t length) {
+    return intrin_detail::welford_block(data, length).variance();
+}
+
+// population covariance (divides by length)
+template <typename T>
+T covariance(const T* x, const T* y, const std::size_t length) {
+    return intrin_detail::comoment_block(x, y, length).covariance();
+}
+
+// index of the first smallest element, 0 for an empty buffer
+template <typename T>
+std::size_t argmin(const T* data, const std::size_t length) {
+    return intrin_detail::arg_extreme<false>(data, length);
+}
+
+// index of the first largest element, 0 for an empty buffer
+template <typename T>
+std::size_t argmax(const T* data, const std::size_t length) {
+    return intrin_detail::arg_extreme<true>(data, length);
+}
+
+// Adds the samples in [lo, hi) to bins equally wide bins; samples outside (and NaNs) are dropped.
+// Every lane counts into its own private copy of the bins, so the gather/add/scatter of one register
+// never hits the same address twice (no conflict detection needed). The copies are summed at the end.
+template <typename T>
+void histogram(const T* data, const std::size_t length, const T lo, const T hi,
+               unsigned int* counts, const std::size_t bins) {
+    using V = vec512<T>;
+    using mask = typename V::mask;
+    if (bins == 0 || !(lo < hi)) { return; }
+
+    std::vector<int> private_bins(bins * V::lanes, 0);
+    int* base = private_bins.data();
+
+    const auto lo_vec = V::set1(lo);
+    const auto hi_vec = V::set1(hi);
+    const auto scale = V::set1(static_cast<T>(bins) / (hi - lo));
+    const __m512i last_bin = _mm512_set1_epi32(static_cast<int>(bins - 1));
+    const __m512i lanes = _mm512_set1_epi32(V::lanes);
+    const __m512i lane_ids = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512i one = _mm512_set1_epi32(1);
+
+    for (std::size_t i = 0; i < length; i += V::lanes) {
+        const mask load_mask = length - i >= static_cast<std::size_t>(V::lanes) ? static_cast<mask>(~mask(0)) : V::tail(length - i);
+        const auto vec = V::loadu(data + i, load_mask);
+        const mask valid = load_mask & V::cmp_le(lo_vec, vec) & V::cmp_lt(vec, hi_vec);
+        if (valid == 0) { continue; }
+
+        __m512i bin = intrin_detail::truncate_to_int32(V::mul(V::sub(vec, lo_vec), scale));
+        bin = _mm512_min_epi32(bin, last_bin); // rounding at the top edge
+        const __m512i slot = _mm512_add_epi32(_mm512_mullo_epi32(bin, lanes), lane_ids);
+
+        const __mmask16 valid16 = static_cast<__mmask16>(valid);
+        const __m512i current = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), valid16, slot, base, 4);
+        _mm512_mask_i32scatter_epi32(base, valid16, slot, _mm512_add_epi32(current, one), 4);
+    }
+
+    for (std::size_t b = 0; b < bins; ++b) {
+        unsigned int total = 0;
+        for (int lane = 0; lane < V::lanes; ++lane) {
+            total += static_cast<unsigned int>(private_bins[b * V::lanes + lane]);
+        }
+        counts[b] += total;
+    }
+}
+
+// out[i] = min(data[i .. i + window - 1]) for i in [0, length - window]; NaNs are skipped (NaN only for a window of NaNs)
+template <typename T>
+void sliding_min(const T* data, const std::size_t length, const std::size_t window, T* out) {
+    intrin_detail::sliding_extreme<false>(data, length, window, out);
+}
+
+// out[i] = max(data[i .. i + window - 1]) for i in [0, length - window]; NaNs are skipped (NaN only for a window of NaNs)
+template <typename T>
+void sliding_max(const T* data, const std::size_t length, const std::size_t window, T* out) {
+    intrin_detail::sliding_extreme<true>(data, length, window, out);
+}
+
+/////////////////////// VECTOR TYPE OVERLOADS - any of the types of intrin_generic.h holding float or double
+
+template <typename T>
+auto mean(const T& type_object) -> decltype(mean(type_object.data, std::size(type_object.data))) {
+    return mean(type_object.data, std::size(type_object.data));
+}
+
+template <typename T>
+auto variance(const T& type_object) -> decltype(variance(type_object.data, std::size(type_object.data))) {
+    return variance(type_object.data, std::size(type_object.data));
+}
+
+template <typename T>
+auto argmin(const T& type_object) -> decltype(argmin(type_object.data, std::size(type_object.data))) {
+    return argmin(type_object.data, std::size(type_object.data));
+}
+
+template <typename T>
+auto argmax(const T& type_object) -> decltype(argmax(type_object.data, std::size(type_object.data))) {
+    return argmax(type_object.data, std::size(type_object.data));
+}
+
+#endif //INTRIN__INTRIN_STATS_H
@@ -0,0 +1,652 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+/*
+Regression tests: every buffer kernel against a scalar (or std::) reference, plus the round trips and
+chunked-versus-whole equivalences the streaming types promise. Built and run by "make test"; prints the
+failed checks and exits non-zero if there are any.
+*/
+
+#include "intrin_generic.h"
+#include "intrin_stats.h"
+#include "intrin_sort.h"
+#include "intrin_scan.h"
+#include "intrin_complex.h"
+#include "intrin_random.h"
+#include "intrin_quant.h"
+#include "intrin_parse.h"
+#include "intrin_pipeline.h"
+#include "intrin_interp.h"
+#include "intrin_image.h"
+#include "intrin_tune.h"
+#include "intrin_codec.h"
+#include "intrin_knn.h"
+#include "intrin_ring.h"
+#include "intrin_resample.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(const bool ok, const char* what) {
+    if (!ok) {
+        ++failures;
+        std::cout << "FAILED: " << what << "\n";
+    }
+}
+
+bool close(const double a, const double b, const double tolerance) { return std::fabs(a - b) <= tolerance * (1.0 + std::fabs(b)); }
+
+template <typename T>
+bool same_or_both_nan(const T a, const T b) { return a == b || (a != a && b != b); }
+
+std::mt19937 rng(2026);
+
+template <typename T>
+std::vector<T> random_values(const std::size_t n, const int range) {
+    std::vector<T> values(n);
+    for (auto& v : values) { v = static_cast<T>(static_cast<int>(rng() % (2 * range + 1)) - range); }
+    return values;
+}
+
+/////////////////////// intrin_stats.h
+
+template <bool Largest, typename T>
+T sliding_reference(const T* data, const std::size_t window) {
+    T best = std::numeric_limits<T>::quiet_NaN();
+    for (std::size_t k = 0; k < window; ++k) {
+        if (data[k] != data[k]) { continue; }
+        if (best != best || (Largest ? data[k] > best : data[k] < best)) { best = data[k]; }
+    }
+    return best;
+}
+
+template <typename T>
+void test_stats() {
+    const std::vector<T> values = random_values<T>(1001, 500);
+    double sum = 0.0, squares = 0.0;
+    for (const T v : values) { sum += v; }
+    const double expected_mean = sum / double(values.size());
+    for (const T v : values) { squares += (v - expected_mean) * (v - expected_mean); }
+    check(close(mean(values.data(), values.size()), expected_mean, 1e-4), "stats: mean");
+    check(close(variance(values.data(), values.size()), squares / double(values.size()), 1e-4), "stats: variance");
+    check(argmax(values.data(), values.size()) == std::size_t(std::max_element(values.begin(), values.end()) - values.begin()), "stats: argmax");
+    check(argmin(values.data(), values.size()) == std::size_t(std::min_element(values.begin(), values.end()) - values.begin()), "stats: argmin");
+
+    // NaNs are skipped wherever they are, a leading one included
+    std::vector<T> with_nan(40, T(1));
+    with_nan[0] = with_nan[17] = std::numeric_limits<T>::quiet_NaN();
+    with_nan[23] = T(5);
+    with_nan[31] = T(-5);
+    check(argmax(with_nan.data(), with_nan.size()) == 23 && argmin(with_nan.data(), with_nan.size()) == 31, "stats: argmin / argmax skip NaNs");
+    const std::vector<T> all_nan(20, std::numeric_limits<T>::quiet_NaN());
+    check(argmax(all_nan.data(), all_nan.size()) == 0, "stats: argmax of all NaN is 0");
+
+    // both the overlapping-load (window <= 32) and the van Herk path, NaNs anywhere
+    for (const std::size_t window : {1, 5, 32, 33, 70}) {
+        std::vector<T> data = random_values<T>(300, 50);
+        for (std::size_t i = 0; i < data.size(); i += 7 + i % 5) { data[i] = std::numeric_limits<T>::quiet_NaN(); }
+        std::fill(data.begin() + 100, data.begin() + 180, std::numeric_limits<T>::quiet_NaN());
+        std::vector<T> low(data.size()), high(data.size());
+        sliding_min(data.data(), data.size(), window, low.data());
+        sliding_max(data.data(), data.size(), window, high.data());
+        bool ok = true;
+        for (std::size_t i = 0; i + window <= data.size(); ++i) {
+            ok = ok && same_or_both_nan(low[i], sliding_reference<false>(data.data() + i, window));
+            ok = ok && same_or_both_nan(high[i], sliding_reference<true>(data.data() + i, window));
+        }
+        check(ok, "stats: sliding_min / sliding_max");
+    }
+
+    unsigned int counts[10] = {};
+    histogram(values.data(), values.size(), T(-500), T(500), counts, 10);
+    unsigned int expected[10] = {};
+    for (const T v : values) {
+        if (v >= T(-500) && v < T(500)) { ++expected[static_cast<int>((v + 500) / 100)]; }
+    }
+    check(std::equal(counts, counts + 10, expected), "stats: histogram");
+}
+
+/////////////////////// intrin_sort.h
+
+template <typename T>
+void test_sort() {
+    for (const std::size_t n : {0, 1, 15, 16, 17, 100, 128, 129, 1000, 5000}) {
+        std::vector<T> data = random_values<T>(n, n > 100 ? 200 : 5); // many duplicates
+        if constexpr (std::is_floating_point_v<T>) {
+            for (std::size_t i = 3; i < n; i += 97) { data[i] = std::numeric_limits<T>::quiet_NaN(); }
+        }
+        std::vector<T> numbers;
+        for (const T v : data) {
+            if (v == v) { numbers.push_back(v); }
+        }
+        std::vector<T> expected = numbers;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<T> sorted = data;
+        simd_sort(sorted.data(), n);
+        bool ok = std::equal(expected.begin(), expected.end(), sorted.begin());
+        for (std::size_t i = expected.size(); i < n; ++i) { ok = ok && sorted[i] != sorted[i]; }
+        check(ok, "sort: simd_sort");
+
+        std::vector<std::size_t> order(n);
+        simd_argsort(data.data(), n, order.data());
+        std::vector<std::size_t> positions = order;
+        std::sort(positions.begin(), positions.end());
+        ok = true;
+        for (std::size_t i = 0; i < n; ++i) { ok = ok && positions[i] == i; }
+        for (std::size_t i = 0; i < expected.size(); ++i) { ok = ok && data[order[i]] == expected[i]; }
+        check(ok, "sort: simd_argsort");
+
+        // key-value: keys sorted, every (key, value) pair kept
+        std::vector<T> keys = random_values<T>(n, 20);
+        std::vector<intrin_detail::sort_index_t<T>> values(n);
+        std::vector<std::pair<T, intrin_detail::sort_index_t<T>>> pairs(n);
+        for (std::size_t i = 0; i < n; ++i) { values[i] = static_cast<intrin_detail::sort_index_t<T>>(i * 7 % 13), pairs[i] = {keys[i], values[i]}; }
+        simd_key_value_sort(keys.data(), values.data(), n);
+        std::vector<std::pair<T, intrin_detail::sort_index_t<T>>> moved(n);
+        for (std::size_t i = 0; i < n; ++i) { moved[i] = {keys[i], values[i]}; }
+        std::sort(pairs.begin(), pairs.end());
+        check(std::is_sorted(keys.begin(), keys.end()) && (std::sort(moved.begin(), moved.end()), moved == pairs), "sort: simd_key_value_sort");
+
+        if (expected.empty()) { continue; }
+        const std::size_t nth = expected.size() / 3;
+        std::vector<T> selected = numbers;
+        simd_nth_element(selected.data(), selected.size(), nth);
+        ok = selected[nth] == expected[nth];
+        for (std::size_t i = 0; i < nth; ++i) { ok = ok && !(selected[nth] < selected[i]); }
+        for (std::size_t i = nth + 1; i < selected.size(); ++i) { ok = ok && !(selected[i] < selected[nth]); }
+        check(ok, "sort: simd_nth_element");
+
+        std::vector<T> partial = numbers;
+        simd_partial_sort(partial.data(), partial.size(), nth + 1);
+        check(std::equal(expected.begin(), expected.begin() + nth + 1, partial.begin()), "sort: simd_partial_sort");
+
+        const std::size_t k = std::min<std::size_t>(10, expected.size());
+        std::vector<T> top(k);
+        std::vector<std::size_t> top_positions(k);
+        simd_top_k(numbers.data(), numbers.size(), k, top.data());
+        simd_arg_top_k(numbers.data(), numbers.size(), k, top_positions.data());
+        ok = true;
+        for (std::size_t i = 0; i < k; ++i) {
+            ok = ok && top[i] == expected[expected.size() - 1 - i] && numbers[top_positions[i]] == top[i];
+        }
+        std::sort(top_positions.begin(), top_positions.end());
+        check(ok && std::adjacent_find(top_positions.begin(), top_positions.end()) == top_positions.end(), "sort: simd_top_k / simd_arg_top_k");
+    }
+}
+
+/////////////////////// intrin_scan.h
+
+void test_scan() {
+    for (const std::size_t n : {0, 1, 16, 17, 1000}) {
+        const std::vector<int> data = random_values<int>(n, 100);
+        std::vector<int> inclusive(n), exclusive(n), expected(n);
+        simd_inclusive_scan(data.data(), inclusive.data(), n);
+        std::partial_sum(data.begin(), data.end(), expected.begin());
+        check(inclusive == expected, "scan: simd_inclusive_scan");
+        simd_exclusive_scan(data.data(), exclusive.data(), n, 5);
+        bool ok = true;
+        for (std::size_t i = 0; i < n; ++i) { ok = ok && exclusive[i] == 5 + expected[i] - data[i]; }
+        check(ok, "scan: simd_exclusive_scan");
+
+        std::vector<int> kept(n), expected_kept;
+        const std::size_t count = simd_copy_if(data.data(), n, kept.data(), above(50));
+        std::copy_if(data.begin(), data.end(), std::back_inserter(expected_kept), [](const int v) { return v > 50; });
+        check(count == expected_kept.size() && std::equal(expected_kept.begin(), expected_kept.end(), kept.begin()), "scan: simd_copy_if");
+        check(simd_count_if(data.data(), n, above(50)) == expected_kept.size(), "scan: simd_count_if");
+        const auto first = std::find_if(data.begin(), data.end(), [](const int v) { return v > 50; });
+        check(simd_find_first(data.data(), n, above(50)) == std::size_t(first - data.begin()), "scan: simd_find_first");
+    }
+}
+
+/////////////////////// intrin_complex.h
+
+void test_complex() {
+    const std::size_t n = 37;
+    std::vector<std::complex<float>> a(n), b(n), product(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = {float(i % 7) - 3.0f, float(i % 5) * 0.5f};
+        b[i] = {0.25f * float(i % 3), 1.0f - float(i % 4)};
+    }
+    complex_multiply(a.data(), b.data(), product.data(), n);
+    std::complex<double> dot = 0.0, vdot = 0.0;
+    bool ok = true;
+    for (std::size_t i = 0; i < n; ++i) {
+        ok = ok && std::abs(product[i] - a[i] * b[i]) < 1e-5f;
+        dot += std::complex<double>(a[i]) * std::complex<double>(b[i]);
+        vdot += std::conj(std::complex<double>(a[i])) * std::complex<double>(b[i]);
+    }
+    check(ok, "complex: complex_multiply");
+    check(std::abs(std::complex<double>(complex_dot(a.data(), b.data(), n)) - dot) < 1e-3, "complex: complex_dot");
+    check(std::abs(std::complex<double>(complex_vdot(a.data(), b.data(), n)) - vdot) < 1e-3, "complex: complex_vdot");
+}
+
+/////////////////////// intrin_random.h
+
+void test_random() {
+    xoshiro256ss_x8 generator(7);
+    std::vector<float> uniform(100000), normal(100000);
+    fill_uniform(generator, uniform.data(), uniform.size());
+    fill_normal(generator, normal.data(), normal.size());
+    check(std::all_of(uniform.begin(), uniform.end(), [](const float v) { return v >= 0.0f && v < 1.0f; }), "random: uniform in [0, 1)");
+    check(std::fabs(mean(uniform.data(), uniform.size()) - 0.5f) < 0.01f, "random: uniform mean");
+    check(std::fabs(mean(normal.data(), normal.size())) < 0.02f && std::fabs(variance(normal.data(), normal.size()) - 1.0f) < 0.03f,
+          "random: normal mean and variance");
+}
+
+/////////////////////// intrin_quant.h
+
+void test_quant() {
+    const std::size_t rows = 5, cols = 7, depth = 67;
+    std::vector<std::uint8_t> activations(rows * depth);
+    std::vector<std::int8_t> weights(cols * depth);
+    for (auto& a : activations) { a = static_cast<std::uint8_t>(rng() % 256); }
+    for (auto& w : weights) { w = static_cast<std::int8_t>(static_cast<int>(rng() % 256) - 128); }
+    std::vector<std::int32_t> acc(rows * cols);
+    quantized_gemm(activations.data(), weights.data(), acc.data(), rows, cols, depth);
+    bool ok = true;
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            std::int32_t expected = 0;
+            for (std::size_t k = 0; k < depth; ++k) { expected += int(activations[r * depth + k]) * int(weights[c * depth + k]); }
+            ok = ok && acc[r * cols + c] == expected;
+        }
+    }
+    check(ok, "quant: quantized_gemm");
+
+    // saturation, also beyond the int32 range after scaling
+    const std::int32_t extremes[4] = {INT_MAX, INT_MIN, 1000, -3};
+    const float scales[4] = {1e3f, 1e3f, 0.01f, 1.0f};
+    std::int8_t narrowed[4] = {};
+    requantize(extremes, 1, 4, scales, nullptr, 5, narrowed);
+    check(narrowed[0] == 127 && narrowed[1] == -128 && narrowed[2] == 15 && narrowed[3] == 2, "quant: requantize saturates");
+}
+
+/////////////////////// intrin_print.h, intrin_parse.h
+
+void test_text() {
+    std::vector<double> values(100);
+    for (std::size_t i = 0; i < values.size(); ++i) { values[i] = std::ldexp(double(rng()) - 2e9, int(i % 40) - 20); }
+    std::string text(text_capacity<double>(values.size(), ", "), '\0');
+    text.resize(format_text(values.data(), values.size(), ", ", text.data()));
+    std::vector<double> parsed(values.size());
+    const parse_result result = parse_numbers(text.data(), text.size(), parsed.data(), parsed.size());
+    check(result.ok() && result.count == values.size() && parsed == values, "text: format_text / parse_numbers round trip");
+
+    const char bad[] = "1, 2\n3, x, 5\n";
+    float numbers[8] = {};
+    const parse_result error = parse_numbers(bad, sizeof(bad) - 1, numbers, 8);
+    check(!error.ok() && error.error_offset == 8 && error.count == 3, "text: parse_numbers reports the bad field");
+}
+
+/////////////////////// intrin_pipeline.h
+
+void test_pipeline() {
+    const std::size_t n = 1003;
+    const std::vector<float> input = random_values<float>(n, 30);
+    const auto pipe = pipeline<float>() | scale_by(2.0f) | add_offset(1.0f) | reduce_max() | clamp_to(-10.0f, 10.0f) | reduce_sum();
+    double expected_sum = 0.0;
+    float expected_max = -1e30f;
+    std::vector<float> expected(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float shaped = input[i] * 2.0f + 1.0f;
+        expected_max = std::max(expected_max, shaped);
+        expected[i] = std::min(std::max(shaped, -10.0f), 10.0f);
+        expected_sum += expected[i];
+    }
+    const tuning_parameters saved = tuning();
+    for (const std::size_t threshold : {static_cast<std::size_t>(-1), std::size_t(0)}) { // cached, then streaming stores
+        tuning_parameters parameters = saved;
+        parameters.streaming_threshold = threshold;
+        set_tuning(parameters);
+        std::vector<float> output(n + 3);
+        const auto [largest, total] = pipe.run(input.data(), output.data() + 3, n);
+        check(largest == expected_max && close(total, expected_sum, 1e-5) && std::equal(expected.begin(), expected.end(), output.begin() + 3),
+              "pipeline: run");
+    }
+    set_tuning(saved);
+}
+
+/////////////////////// intrin_interp.h
+
+void test_interp() {
+    const std::vector<float> x = random_values<float>(301, 40);
+    std::vector<float> xs(x.size()), y(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) { xs[i] = x[i] / 10.0f; }
+    const float c[4] = {0.5f, -1.0f, 0.25f, 0.125f};
+    evaluate_polynomial(xs.data(), y.data(), xs.size(), c);
+    bool ok = true;
+    for (std::size_t i = 0; i < xs.size(); ++i) { ok = ok && close(y[i], c[0] + xs[i] * (c[1] + xs[i] * (c[2] + xs[i] * c[3])), 1e-5); }
+    check(ok, "interp: evaluate_polynomial");
+
+    std::vector<float> table(40);
+    for (std::size_t i = 0; i < table.size(); ++i) { table[i] = std::sin(0.3f * float(i)); }
+    const lut_interpolator<float> lut(table.data(), table.size(), -4.0f, 4.0f);
+    lut.apply(xs.data(), y.data(), xs.size());
+    ok = true;
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        const float position = (std::min(std::max(xs[i], -4.0f), 4.0f) + 4.0f) / 8.0f * float(table.size() - 1);
+        const std::size_t below = std::min<std::size_t>(static_cast<std::size_t>(position), table.size() - 2);
+        const float fraction = position - float(below);
+        ok = ok && std::fabs(y[i] - (table[below] + fraction * (table[below + 1] - table[below]))) < 1e-5f;
+    }
+    check(ok, "interp: lut_interpolator");
+
+    const double knots[5] = {0.0, 1.0, 2.5, 3.0, 5.0}, heights[5] = {1.0, -1.0, 2.0, 0.0, 4.0};
+    const cubic_spline<double> spline(knots, heights, 5);
+    double through[5] = {};
+    spline.apply(knots, through, 5);
+    ok = true;
+    for (int i = 0; i < 5; ++i) { ok = ok && std::fabs(through[i] - heights[i]) < 1e-12; }
+    check(ok, "interp: cubic_spline passes through the knots");
+}
+
+/////////////////////// intrin_image.h
+
+void test_image() {
+    const std::size_t width = 37, height = 23, radius = 2;
+    std::vector<float> pixels(width * height), blurred(width * height);
+    for (auto& p : pixels) { p = float(rng() % 256); }
+    box_blur(image_plane<const float> {pixels.data(), width, height, width}, image_plane<float> {blurred.data(), width, height, width}, radius);
+    bool ok = true;
+    for (std::size_t y = 0; y < height; ++y) {
+        for (std::size_t x = 0; x < width; ++x) {
+            double sum = 0.0;
+            for (long long dy = -2; dy <= 2; ++dy) {
+                for (long long dx = -2; dx <= 2; ++dx) {
+                    const long long sy = std::min<long long>(std::max<long long>(y + dy, 0), height - 1);
+                    const long long sx = std::min<long long>(std::max<long long>(x + dx, 0), width - 1);
+                    sum += pixels[sy * width + sx];
+                }
+            }
+            ok = ok && std::fabs(blurred[y * width + x] - sum / 25.0) < 1e-3;
+        }
+    }
+    check(ok, "image: box_blur");
+
+    const std::vector<std::uint8_t> flat(width * height, 77);
+    std::vector<std::uint8_t> smoothed(width * height);
+    gaussian_blur(image_plane<const std::uint8_t> {flat.data(), width, height, width}, image_plane<std::uint8_t> {smoothed.data(), width, height, width}, 1.5f);
+    check(smoothed == flat, "image: gaussian_blur keeps a flat plane");
+
+    std::vector<float> halved((width / 2) * (height / 2));
+    resize_area(image_plane<const float> {pixels.data(), width / 2 * 2, height / 2 * 2, width}, image_plane<float> {halved.data(), width / 2, height / 2, width / 2});
+    ok = true;
+    for (std::size_t y = 0; y < height / 2; ++y) {
+        for (std::size_t x = 0; x < width / 2; ++x) {
+            const std::size_t at = 2 * y * width + 2 * x;
+            ok = ok && std::fabs(halved[y * (width / 2) + x] - (pixels[at] + pixels[at + 1] + pixels[at + width] + pixels[at + width + 1]) / 4.0f) < 1e-3f;
+        }
+    }
+    check(ok, "image: resize_area halves exactly");
+}
+
+/////////////////////// intrin_tune.h
+
+void test_tune() {
+    const char* path = "intrin_test.tuning";
+    std::remove(path);
+    tuning_parameters first, second, loaded;
+    first.tile_bytes = 12345, first.streaming_threshold = 999;
+    second.tile_bytes = 4096, second.streaming_threshold = 1 << 20;
+    save_tuning(path, first, "host a");
+    save_tuning(path, second, "host b");
+    save_tuning(path, second, "host a"); // replaces the first line
+    check(load_tuning(path, loaded, "host a") && loaded.tile_bytes == 4096 && loaded.streaming_threshold == (1 << 20), "tune: save / load per host");
+    check(!load_tuning(path, loaded, "host c"), "tune: unknown host");
+    std::remove(path);
+
+    // streaming copies of every size and alignment, including ones shorter than the alignment head
+    const tuning_parameters saved = tuning();
+    tuning_parameters streaming = saved;
+    streaming.streaming_threshold = 0;
+    set_tuning(streaming);
+    alignas(64) char source[512], target[512];
+    for (int i = 0; i < 512; ++i) { source[i] = static_cast<char>(i * 13); }
+    bool ok = true;
+    for (int offset = 0; offset < 64; ++offset) {
+        for (int bytes = 0; bytes < 300; bytes += 7) {
+            std::fill(target, target + 512, char(0x55));
+            bulk_copy(target + offset, source + 3, static_cast<std::size_t>(bytes));
+            for (int i = 0; i < 512; ++i) { ok = ok && target[i] == (i >= offset && i < offset + bytes ? source[3 + i - offset] : char(0x55)); }
+        }
+    }
+    set_tuning(saved);
+    check(ok, "tune: bulk_copy");
+}
+
+/////////////////////// intrin_codec.h
+
+void test_codec() {
+    for (const std::size_t n : {0, 1, 100, 512, 513, 1500}) {
+        const std::vector<std::int16_t> samples = random_values<std::int16_t>(n, 30000);
+        std::vector<std::uint16_t> deltas(n);
+        std::vector<std::int16_t> restored(n);
+        delta_zigzag_encode(samples.data(), n, deltas.data(), std::int16_t(3));
+        const unsigned bits = max_bits(deltas.data(), n);
+        std::vector<std::uint32_t> packed(packed_words(n, bits) + 1);
+        const std::size_t words = bit_pack(deltas.data(), n, bits, packed.data());
+        std::vector<std::uint16_t> unpacked(n);
+        const std::size_t read = bit_unpack(packed.data(), n, bits, unpacked.data());
+        delta_zigzag_decode(unpacked.data(), n, restored.data(), std::int16_t(3));
+        check(words == packed_words(n, bits) && read == words && restored == samples, "codec: delta + zigzag + bit packing round trip");
+
+        std::vector<std::uint32_t> wide(n);
+        for (unsigned width = 0; width <= 32; ++width) {
+            for (std::size_t i = 0; i < n; ++i) { wide[i] = static_cast<std::uint32_t>(rng()) & (width == 32 ? 0xffffffffu : (1u << width) - 1); }
+            std::vector<std::uint32_t> out(packed_words(n, width) + 1), back(n);
+            bit_pack(wide.data(), n, width, out.data());
+            bit_unpack(out.data(), n, width, back.data());
+            check(back == wide, "codec: bit packing at every width");
+        }
+        check(bit_pack(deltas.data(), n, 17, packed.data()) == codec_error && bit_unpack(packed.data(), n, 33, wide.data()) == codec_error,
+              "codec: invalid widths");
+
+        const std::vector<std::int32_t> values = random_values<std::int32_t>(n, 5000);
+        std::vector<std::uint32_t> stream(frame_of_reference_bound(n));
+        const std::size_t used = frame_of_reference_encode(values.data(), n, stream.data());
+        std::vector<std::int32_t> decoded(n);
+        check(frame_of_reference_decode(stream.data(), used, n, decoded.data()) == used && decoded == values, "codec: frame of reference round trip");
+        bool truncated = true;
+        for (std::size_t shorter = 0; shorter < used; ++shorter) {
+            truncated = truncated && frame_of_reference_decode(stream.data(), shorter, n, decoded.data()) == codec_error;
+        }
+        check(truncated, "codec: truncated frame of reference streams");
+        if (n > 0) {
+            stream[1] = 40;
+            check(frame_of_reference_decode(stream.data(), used, n, decoded.data()) == codec_error, "codec: corrupt bit width");
+        }
+    }
+}
+
+/////////////////////// intrin_knn.h
+
+void test_knn() {
+    const std::size_t count = 203, dim = 37, queries = 9, k = 5;
+    std::vector<float> rows(count * dim), query(queries * dim);
+    for (auto& v : rows) { v = float(static_cast<int>(rng() % 2001) - 1000) / 1000.0f; }
+    for (auto& v : query) { v = float(static_cast<int>(rng() % 2001) - 1000) / 1000.0f; }
+    const knn_database<float> database(rows.data(), count, dim);
+
+    for (const distance_metric metric : {distance_metric::l2, distance_metric::inner_product, distance_metric::cosine}) {
+        std::vector<float> distances(queries * count);
+        batch_distances(query.data(), queries, database, metric, distances.data());
+        std::vector<std::size_t> nearest(queries * k);
+        std::vector<float> nearest_distances(queries * k);
+        knn_search(query.data(), queries, database, k, metric, nearest.data(), nearest_distances.data());
+        bool ok = true, ranked = true;
+        for (std::size_t q = 0; q < queries; ++q) {
+            std::vector<double> expected(count);
+            for (std::size_t r = 0; r < count; ++r) {
+                double dot = 0.0, qq = 0.0, rr = 0.0;
+                for (std::size_t i = 0; i < dim; ++i) {
+                    dot += double(query[q * dim + i]) * rows[r * dim + i];
+                    qq += double(query[q * dim + i]) * query[q * dim + i];
+                    rr += double(rows[r * dim + i]) * rows[r * dim + i];
+                }
+                expected[r] = metric == distance_metric::l2 ? qq + rr - 2.0 * dot : metric == distance_metric::inner_product ? -dot : 1.0 - dot / std::sqrt(qq * rr);
+                ok = ok && std::fabs(distances[q * count + r] - expected[r]) < 1e-4;
+            }
+            std::vector<double> best = expected;
+            std::sort(best.begin(), best.end());
+            for (std::size_t j = 0; j < k; ++j) {
+                ranked = ranked && std::fabs(nearest_distances[q * k + j] - best[j]) < 1e-4 && std::fabs(expected[nearest[q * k + j]] - best[j]) < 1e-4;
+            }
+        }
+        check(ok, "knn: batch_distances");
+        check(ranked, "knn: knn_search");
+    }
+}
+
+/////////////////////// intrin_ring.h
+
+template <typename Ring>
+void ring_round_trip(const int producers, const int consumers, const char* what) {
+    const int blocks_each = 2000;
+    Ring ring(8, ring_wait::futex);
+    std::vector<long long> sums(consumers, 0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&ring, p] {
+            for (int b = 0; b < blocks_each; ++b) {
+                const auto slot = ring.claim();
+                for (int i = 0; i < 16; ++i) { slot->data[i] = p * blocks_each + b + i; }
+                slot->count = 16;
+                ring.commit(slot);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&ring, &sums, c, consumers, producers] {
+            for (int b = c; b < producers * blocks_each; b += consumers) {
+                const auto slot = ring.acquire();
+                for (std::size_t i = 0; i < slot->count; ++i) { sums[c] += slot->data[i]; }
+                ring.release(slot);
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    long long expected = 0;
+    for (int p = 0; p < producers; ++p) {
+        for (int b = 0; b < blocks_each; ++b) { expected += 16LL * (p * blocks_each + b) + 120; }
+    }
+    check(std::accumulate(sums.begin(), sums.end(), 0LL) == expected, what);
+}
+
+void test_ring() {
+    ring_round_trip<spsc_ring<sample_block<int, 16>>>(1, 1, "ring: spsc_ring delivers every block");
+    ring_round_trip<mpmc_ring<sample_block<int, 16>>>(3, 2, "ring: mpmc_ring delivers every block");
+}
+
+/////////////////////// intrin_resample.h
+
+// signal fed in irregular chunks, outputs collected
+template <typename Resampler>
+std::vector<float> in_chunks(Resampler& resampler, const std::vector<float>& signal, const std::size_t multiplier, const std::size_t modulus) {
+    std::vector<float> pieces;
+    for (std::size_t at = 0, chunk = 1; at < signal.size(); at += chunk, chunk = (chunk * multiplier + 11) % modulus) {
+        chunk = std::min(chunk, signal.size() - at);
+        std::vector<float> piece(resampler.max_output(chunk));
+        piece.resize(resampler.process(signal.data() + at, chunk, piece.data()));
+        pieces.insert(pieces.end(), piece.begin(), piece.end());
+    }
+    return pieces;
+}
+
+template <typename Resampler>
+std::vector<float> at_once(Resampler& resampler, const std::vector<float>& signal) {
+    std::vector<float> out(resampler.max_output(signal.size()));
+    out.resize(resampler.process(signal.data(), signal.size(), out.data()));
+    return out;
+}
+
+bool near_equal(const std::vector<float>& a, const std::vector<float>& b, const float tolerance) {
+    if (a.size() != b.size()) { return false; }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (!(std::fabs(a[i] - b[i]) <= tolerance)) { return false; }
+    }
+    return true;
+}
+
+void test_resample() {
+    std::vector<float> signal(20000);
+    for (std::size_t i = 0; i < signal.size(); ++i) { signal[i] = static_cast<float>(std::sin(0.001 * double(i))); }
+
+    // 47 / 97 once ended a chunk just below an output position (process() asserts the position on entry)
+    for (const resample_kind kind : {resample_kind::linear, resample_kind::cubic}) {
+        fractional_resampler<float> whole(1.0 / 44.1, kind), chunked(1.0 / 44.1, kind), stretched(1.37, kind);
+        check(near_equal(in_chunks(chunked, signal, 47, 97), at_once(whole, signal), 1e-4f), "resample: fractional chunked equals one call");
+        const std::vector<float> longer = at_once(stretched, signal);
+        bool ok = longer.size() > 27000;
+        for (std::size_t j = 10; ok && j + 10 < longer.size(); ++j) { ok = std::fabs(longer[j] - std::sin(0.001 * (j / 1.37))) < 1e-4; }
+        check(ok, "resample: fractional follows a slow sine");
+    }
+
+    polyphase_resampler<float> whole(250, 1000), chunked(250, 1000);
+    check(near_equal(in_chunks(chunked, signal, 37, 257), at_once(whole, signal), 0.0f), "resample: polyphase chunked equals one call");
+    polyphase_resampler<float> down(48000, 44100);
+    const std::vector<float> converted = at_once(down, signal);
+    bool ok = !converted.empty();
+    for (std::size_t j = 200; ok && j + 200 < converted.size(); ++j) {
+        ok = std::fabs(converted[j] - std::sin(0.001 * (double(j) * 48000.0 / 44100.0 - down.delay()))) < 1e-3;
+    }
+    check(ok, "resample: polyphase 48 -> 44.1 kHz follows a slow sine");
+}
+
+} // namespace
+
+int main() {
+    test_stats<float>();
+    test_stats<double>();
+    test_sort<float>();
+    test_sort<double>();
+    test_sort<int>();
+    test_sort<long long>();
+    test_scan();
+    test_complex();
+    test_random();
+    test_quant();
+    test_text();
+    test_pipeline();
+    test_interp();
+    test_image();
+    test_tune();
+    test_codec();
+    test_knn();
+    test_ring();
+    test_resample();
+    std::cout << (failures ? "some checks failed\n" : "all checks passed\n");
+    return failures ? 1 : 0;
+}
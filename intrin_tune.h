@@ -0,0 +1,316 @@
+//
+/*
+
+Copyright 2026 JATIN AGGARWAL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+and associated documentation files (the “Software”), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies
+or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+// Cache topology detection and autotuning of tile sizes and the non-temporal store threshold.
+// usage: set_tuning(tune_for_host("/var/cache/intrin.tuning"));   // at startup, before the worker threads
+//        const std::size_t tile = tuning().tile_bytes;
+//
+// Cache sizes come from cpuid (leaf 4 on Intel, 0x8000001D on AMD), then sysfs, then fixed defaults.
+// Until a tuning is set, tuning() holds values derived from the detected caches without any benchmark.
+// autotune() times small blocked kernels for each candidate and keeps the fastest; tune_for_host() reuses
+// the result stored in the file for this host (cpu brand + cache sizes) or tunes and stores it. One file can
+// hold the lines of several hosts, e.g. on a shared home directory.
+//
+// tile_bytes sizes the strips of intrin_image.h and the database tiles of intrin_knn.h; streaming_threshold
+// switches the stores of pipeline run() (intrin_pipeline.h) and of bulk_copy to non-temporal ones.
+// Reductions keep their fixed accumulator counts (unrolled at compile time).
+
+#ifndef INTRIN__INTRIN_TUNE_H
+#define INTRIN__INTRIN_TUNE_H
+
+#include "intrin_generic.h"
+#include <chrono>
+#include <cpuid.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct cache_topology {
+    std::size_t line = 64;
+    std::size_t l1d = 32 * 1024;
+    std::size_t l2 = 1024 * 1024;
+    std::size_t l3 = 8 * 1024 * 1024;
+};
+
+struct tuning_parameters {
+    std::size_t tile_bytes = 512 * 1024;                         // working set of one cache-blocked tile (strips, database tiles)
+    std::size_t streaming_threshold = static_cast<std::size_t>(-1); // output bytes from which stores bypass the caches (pipelines, bulk_copy)
+};
+
+namespace intrin_detail {
+
+// cpuid deterministic cache parameters (leaf 4 and AMD's 0x8000001D share the layout)
+inline bool cpuid_caches(const unsigned leaf, cache_topology& caches) {
+    unsigned eax, ebx, ecx, edx;
+    bool found = false;
+    for (unsigned index = 0; index < 16; ++index) {
+        if (!__get_cpuid_count(leaf, index, &eax, &ebx, &ecx, &edx)) { return false; }
+        const unsigned type = eax & 0x1f; // 1 data, 2 instruction, 3 unified
+        if (type == 0) { break; }
+        if (type == 2) { continue; }
+        const unsigned level = (eax >> 5) & 0x7;
+        const std::size_t line = (ebx & 0xfff) + 1;
+        const std::size_t size = (((ebx >> 22) & 0x3ff) + 1) * (((ebx >> 12) & 0x3ff) + 1) * line * (std::size_t(ecx) + 1);
+        if (level == 1) { caches.l1d = size, caches.line = line; }
+        if (level == 2) { caches.l2 = size; }
+        if (level == 3) { caches.l3 = size; }
+        found = true;
+    }
+    return found;
+}
+
+inline bool sysfs_caches(cache_topology& caches) {
+    bool found = false;
+    for (int index = 0; index < 8; ++index) {
+        const std::string directory = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+        std::ifstream level_file(directory + "level"), type_file(directory + "type"), size_file(directory + "size");
+        int level = 0;
+        std::string type, size;
+        if (!(level_file >> level) || !(type_file >> type) || !(size_file >> size) || type == "Instruction") { continue; }
+        std::size_t bytes = std::stoul(size);
+        if (size.back() == 'K') { bytes *= 1024; }
+        if (size.back() == 'M') { bytes *= 1024 * 1024; }
+        if (level == 1) { caches.l1d = bytes; }
+        if (level == 2) { caches.l2 = bytes; }
+        if (level == 3) { caches.l3 = bytes; }
+        found = true;
+    }
+    return found;
+}
+
+inline double seconds_since(const std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// best (lowest) time of a few runs, seconds
+template <typename Function>
+double best_time(Function&& run, const int repeats = 5) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const double elapsed = seconds_since(start);
+        best = elapsed < best ? elapsed : best;
+    }
+    return best;
+}
+
+// the access pattern of strip-mined kernels: several read-modify-write passes over one tile before the next
+inline void blocked_passes(float* data, const std::size_t n, const std::size_t tile) {
+    using V = vec512<float>;
+    const auto scale = V::set1(0.999f), offset = V::set1(0.001f);
+    for (std::size_t base = 0; base < n; base += tile) {
+        const std::size_t end = base + tile < n ? base + tile : n;
+        for (int pass = 0; pass < 4; ++pass) {
+            for (std::size_t i = base; i < end; i += V::lanes) {
+                const auto m = V::up_to(end - i);
+                V::storeu(data + i, V::fmadd(V::loadu(data + i, m), scale, offset), m);
+            }
+        }
+    }
+}
+
+// dst and src 64 byte aligned, bytes a multiple of 64
+inline void stream_copy_aligned(void* dst, const void* src, const std::size_t bytes) {
+    auto* out = static_cast<__m512i*>(dst);
+    const auto* in = static_cast<const __m512i*>(src);
+    for (std::size_t i = 0; i < bytes / 64; ++i) { _mm512_stream_si512(out + i, _mm512_load_si512(in + i)); }
+    _mm_sfence();
+}
+
+inline std::string read_tuning_file(const char* path) {
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+} // namespace intrin_detail
+
+/////////////////////// TUNING FUNCTIONS - topology
+
+inline cache_topology detect_cache_topology() {
+    cache_topology caches;
+    unsigned eax, ebx, ecx, edx;
+    char vendor[13] = {};
+    if (__get_cpuid(0, &eax, &ebx, &ecx, &edx)) {
+        std::memcpy(vendor, &ebx, 4), std::memcpy(vendor + 4, &edx, 4), std::memcpy(vendor + 8, &ecx, 4);
+        const bool amd = std::strcmp(vendor, "AuthenticAMD") == 0;
+        if (!amd && eax >= 4 && intrin_detail::cpuid_caches(4, caches)) { return caches; }
+        if (amd && __get_cpuid_max(0x80000000, nullptr) >= 0x8000001D && intrin_detail::cpuid_caches(0x8000001D, caches)) { return caches; }
+    }
+    intrin_detail::sysfs_caches(caches);
+    return caches;
+}
+
+// cpu brand string plus cache sizes: the key of a stored tuning
+inline std::string host_signature(const cache_topology& caches = detect_cache_topology()) {
+    std::string brand;
+    unsigned regs[4];
+    if (__get_cpuid_max(0x80000000, nullptr) >= 0x80000004) {
+        for (unsigned leaf = 0x80000002; leaf <= 0x80000004; ++leaf) {
+            __get_cpuid(leaf, &regs[0], &regs[1], &regs[2], &regs[3]);
+            brand.append(reinterpret_cast<const char*>(regs), sizeof(regs));
+        }
+        brand = brand.c_str(); // drop the zero padding
+    }
+    while (!brand.empty() && brand.back() == ' ') { brand.pop_back(); }
+    for (char& c : brand) { c = c == '\t' ? ' ' : c; }
+    return brand + " L1d " + std::to_string(caches.l1d) + " L2 " + std::to_string(caches.l2) + " L3 " + std::to_string(caches.l3);
+}
+
+/////////////////////// TUNING FUNCTIONS - parameters
+
+// no benchmark: half of L2 per tile (the rest for the inputs streaming through),
+// non-temporal stores once a copy is larger than the last level cache; a missing (zero) L2 or L3
+// keeps the tuning_parameters defaults
+inline tuning_parameters default_tuning(const cache_topology& caches = detect_cache_topology()) {
+    tuning_parameters parameters;
+    if (caches.l2 != 0) { parameters.tile_bytes = caches.l2 / 2; }
+    if (caches.l3 != 0) { parameters.streaming_threshold = caches.l3; }
+    return parameters;
+}
+
+// times every candidate on this machine and keeps the fastest; takes a few hundred milliseconds
+inline tuning_parameters autotune(const cache_topology& caches = detect_cache_topology()) {
+    tuning_parameters parameters = default_tuning(caches);
+
+    // tile: blocked multi-pass kernel over a buffer well beyond L2
+    {
+        const std::size_t n = 16 * caches.l2 / sizeof(float);
+        std::vector<float, aligned_allocator<float>> data(n, 1.0f);
+        double best = 1e30;
+        for (const std::size_t tile : {caches.l2 / 8, caches.l2 / 4, caches.l2 / 2, caches.l2 * 3 / 4, caches.l2, caches.l2 * 2}) {
+            if (tile < 4096) { continue; }
+            const double time = intrin_detail::best_time([&] { intrin_detail::blocked_passes(data.data(), n, tile / sizeof(float)); }, 3);
+            if (time < best) { best = time, parameters.tile_bytes = tile; }
+        }
+    }
+
+    // streaming threshold: smallest copy size at which non-temporal stores beat the cached ones, sizes up to
+    // 4 x L3 (at most 128 MB); the default stays when none wins and the largest size is within 2 x L3, and
+    // when there is no size to try (a reported L3 below L2 / 4, or no L2, as in some virtual machines)
+    const std::size_t limit = 4 * caches.l3 < (std::size_t(128) << 20) ? 4 * caches.l3 : (std::size_t(128) << 20);
+    std::vector<std::size_t> sizes;
+    for (std::size_t bytes = caches.l2; bytes != 0 && bytes <= limit; bytes *= 2) { sizes.push_back(bytes / 64 * 64); }
+    if (!sizes.empty()) {
+        if (sizes.back() >= 2 * caches.l3) { parameters.streaming_threshold = static_cast<std::size_t>(-1); }
+        std::vector<char, aligned_allocator<char>> source(sizes.back(), 1), target(sizes.back(), 0);
+        for (const std::size_t bytes : sizes) {
+            const double cached = intrin_detail::best_time([&] { std::memcpy(target.data(), source.data(), bytes); });
+            const double streamed = intrin_detail::best_time([&] { intrin_detail::stream_copy_aligned(target.data(), source.data(), bytes); });
+            if (streamed < cached * 0.95) {
+                parameters.streaming_threshold = bytes;
+                break;
+            }
+        }
+    }
+    return parameters;
+}
+
+// the parameters stored for signature in the file; false when the file or the host's line is missing
+inline bool load_tuning(const char* path, tuning_parameters& parameters, const std::string& signature = host_signature()) {
+    std::istringstream lines(intrin_detail::read_tuning_file(path));
+    std::string line;
+    while (std::getline(lines, line)) {
+        const std::size_t tab = line.find('\t');
+        if (tab == std::string::npos || line.compare(0, tab, signature) != 0 || tab != signature.size()) { continue; }
+        std::istringstream values(line.substr(tab + 1));
+        tuning_parameters loaded;
+        std::string extra; // lines of the older three-value format are tuned again
+        if (values >> loaded.tile_bytes >> loaded.streaming_threshold && !(values >> extra)) {
+            parameters = loaded;
+            return true;
+        }
+    }
+    return false;
+}
+
+// writes (or replaces) this host's line, keeping the lines of other hosts; one line per host:
+// signature <tab> tile_bytes streaming_threshold
+inline bool save_tuning(const char* path, const tuning_parameters& parameters, const std::string& signature = host_signature()) {
+    std::istringstream lines(intrin_detail::read_tuning_file(path));
+    std::string contents, line;
+    while (std::getline(lines, line)) {
+        const std::size_t tab = line.find('\t');
+        if (tab == signature.size() && line.compare(0, tab, signature) == 0) { continue; }
+        if (!line.empty()) { contents += line + '\n'; }
+    }
+    contents += signature + '\t' + std::to_string(parameters.tile_bytes) + ' ' + std::to_string(parameters.streaming_threshold) + '\n';
+    std::ofstream file(path, std::ios::trunc);
+    file << contents;
+    return static_cast<bool>(file);
+}
+
+// the stored tuning of this host, or a fresh autotune() that is then stored
+inline tuning_parameters tune_for_host(const char* path) {
+    const cache_topology caches = detect_cache_topology();
+    const std::string signature = host_signature(caches);
+    tuning_parameters parameters;
+    if (load_tuning(path, parameters, signature)) { return parameters; }
+    parameters = autotune(caches);
+    save_tuning(path, parameters, signature);
+    return parameters;
+}
+
+/////////////////////// TUNING FUNCTIONS - process wide
+
+namespace intrin_detail {
+inline tuning_parameters& active_tuning() {
+    static tuning_parameters parameters = default_tuning();
+    return parameters;
+}
+} // namespace intrin_detail
+
+// the parameters kernels read; default_tuning() until set_tuning is called
+inline const tuning_parameters& tuning() { return intrin_detail::active_tuning(); }
+
+// not synchronized: call before kernels run on other threads
+inline void set_tuning(const tuning_parameters& parameters) { intrin_detail::active_tuning() = parameters; }
+
+// memcpy, with non-temporal stores once bytes reaches tuning().streaming_threshold so that large copies
+// do not evict the working set
+inline void bulk_copy(void* dst, const void* src, std::size_t bytes) {
+    if (bytes < tuning().streaming_threshold) {
+        std::memcpy(dst, src, bytes);
+        return;
+    }
+    auto* out = static_cast<char*>(dst);
+    const auto* in = static_cast<const char*>(src);
+    const std::size_t align = (64 - reinterpret_cast<std::uintptr_t>(out) % 64) % 64;
+    const std::size_t head = align < bytes ? align : bytes; // a small threshold can send copies shorter than the head
+    std::memcpy(out, in, head);
+    out += head, in += head, bytes -= head;
+    const std::size_t body = bytes / 64 * 64;
+    for (std::size_t i = 0; i < body; i += 64) {
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(out + i), _mm512_loadu_si512(in + i));
+    }
+    _mm_sfence();
+    std::memcpy(out + body, in + body, bytes - body);
+}
+
+#endif //INTRIN__INTRIN_TUNE_H